@@ -2,23 +2,31 @@
 
 void advect_all_scalars() {
 
-  real2d dummy("dummy",nz,ncrms);
-  real1d esmt_offset("esmt_offset", ncrms);
+  ScratchScope scratch;
+
+  real2d dummy       = scratch.get("dummy",nz,ncrms);
+  real1d esmt_offset = scratch.get("esmt_offset", ncrms);
   YAKL_SCOPE( u_esmt  , :: u_esmt);
   YAKL_SCOPE( v_esmt  , :: v_esmt);
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real1d esmt_min("esmt_min",ncrms);
+  real1d esmt_min = scratch.get("esmt_min",ncrms);
   yakl::memset(esmt_min,1.0e20);
 
   // advection of scalars :
   advect_scalar(t,dummy,dummy);
 
-  // Advection of microphysics prognostics:
+  // Advection of microphysics prognostics (all active fields at once):
+  int nmicro_adv = 0;
   for (int k=0; k<nmicro_fields; k++) {
     if ( k==index_water_vapor || (docloud && flag_precip(k)!=1) || (doprecip && flag_precip(k)==1) ) {
-      advect_scalar(micro_field,k,mkadv,k,mkwle,k);  
+      micro_adv_inds_host(nmicro_adv) = k;
+      nmicro_adv++;
     }
   }
+  if (nmicro_adv > 0) {
+    micro_adv_inds_host.deep_copy_to(micro_adv_inds);
+    advect_scalar(micro_field,micro_adv_inds,nmicro_adv,mkadv,mkwle);
+  }
 
   // Advection of sgs prognostics:
   if (dosgs && advect_sgs) {
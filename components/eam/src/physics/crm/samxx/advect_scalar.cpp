@@ -3,7 +3,9 @@
 void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
   YAKL_SCOPE( ncrms  , ::ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
+  ScratchScope scratch;
+
+  real4d f0 = scratch.get("f0", nzm, dimy_s, dimx_s, ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -51,7 +53,9 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
 void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
+  ScratchScope scratch;
+
+  real4d f0 = scratch.get("f0", nzm, dimy_s, dimx_s, ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -96,49 +100,58 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
 
 }
 
-void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux) {
+// Batched version: advects the tracers f(inds(t),...), t=0,...,ntr-1, with the
+// advective tendencies and fluxes stored in fadv(inds(t),...) and flux(inds(t),...)
+void advect_scalar(real5d &f, int1d &inds, int ntr, real3d &fadv, real3d &flux) {
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
+  ScratchScope scratch;
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  real5d f0 = scratch.get("f0", ntr, nzm, dimy_s, dimx_s, ncrms);
+
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
   if (docolumn) {
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      flux(ind_flux,k,icrm) = 0.0;
+    parallel_for( SimpleBounds<3>(ntr,nz,ncrms) , YAKL_LAMBDA (int t, int k, int icrm) {
+      flux(inds(t),k,icrm) = 0.0;
     });
 
   } else {
 
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<dimy_s; j++) {
-    //     for (int i=0; i<dimx_s; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      f0(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<dimy_s; j++) {
+    //       for (int i=0; i<dimx_s; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+      f0(t,k,j,i,icrm) = f(inds(t),k,j,i,icrm);
     });
 
-    if(RUN3D) {
-      advect_scalar3D(f,ind_f,flux,ind_flux);
+    if (RUN3D) {
+      advect_scalar3D(f,inds,ntr,flux);
     } else {
-      advect_scalar2D(f,ind_f,flux,ind_flux);
+      advect_scalar2D(f,inds,ntr,flux);
     }
 
-    // for (int k=0; k<nzm; k++) {
-    //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      fadv(ind_fadv,k,icrm)=0.0;
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(ntr,nzm,ncrms) , YAKL_LAMBDA (int t, int k, int icrm) {
+      fadv(inds(t),k,icrm)=0.0;
     });
-    
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
-      yakl::atomicAdd(fadv(ind_fadv,k,icrm),tmp);
+
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<ny; j++) {
+    //       for (int i=0; i<nx; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,ny,nx,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+      int l = inds(t);
+      real tmp = f(l,k,j+offy_s,i+offx_s,icrm)-f0(t,k,j+offy_s,i+offx_s,icrm);
+      yakl::atomicAdd(fadv(l,k,icrm),tmp);
     });
 
-  }  
+  }
 
 }
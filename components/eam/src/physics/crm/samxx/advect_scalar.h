@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "scratch.h"
 #include "advect_scalar2D.h"
 #include "advect_scalar3D.h"
 
@@ -10,5 +11,5 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux);
 
 void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux);
 
-void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux);
+void advect_scalar(real5d &f, int1d &inds, int ntr, real3d &fadv, real3d &flux);
 
@@ -17,13 +17,15 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j        = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch;
+
+  real4d mx    = scratch.get("mx"   ,nzm,1,nx+2,ncrms);
+  real4d mn    = scratch.get("mn"   ,nzm,1,nx+2,ncrms);
+  real4d uuu   = scratch.get("uuu"  ,nzm,1,nx+5,ncrms);
+  real4d www   = scratch.get("www"  ,nz,1,nx+4,ncrms);
+  real2d iadz  = scratch.get("iadz" ,nzm,ncrms);
+  real2d irho  = scratch.get("irho" ,nzm,ncrms);
+  real2d irhow = scratch.get("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -212,13 +214,15 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch;
+
+  real4d mx    = scratch.get("mx"   ,nzm,1,nx+2,ncrms);
+  real4d mn    = scratch.get("mn"   ,nzm,1,nx+2,ncrms);
+  real4d uuu   = scratch.get("uuu"  ,nzm,1,nx+5,ncrms);
+  real4d www   = scratch.get("www"  ,nz,1,nx+4,ncrms);
+  real2d iadz  = scratch.get("iadz" ,nzm,ncrms);
+  real2d irho  = scratch.get("irho" ,nzm,ncrms);
+  real2d irhow = scratch.get("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -391,7 +395,10 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
 
 }
 
-void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
+// Batched version: advects the tracers f(inds(t),...), t=0,...,ntr-1, in the same set of kernels.
+// The velocity boundary conditions and the inverse density/layer thickness are computed only once.
+// Each tracer is advected independently, so the result is the same as advecting them one by one.
+void advect_scalar2D(real5d &f, int1d &inds, int ntr, real3d &flux) {
   YAKL_SCOPE( dowallx        , :: dowallx);
   YAKL_SCOPE( rank           , :: rank);
   YAKL_SCOPE( u              , :: u);
@@ -408,18 +415,21 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch;
 
-  // for (int i=0; i<nx+4; i++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
+  real5d mx    = scratch.get("mx"   ,ntr,nzm,1,nx+2,ncrms);
+  real5d mn    = scratch.get("mn"   ,ntr,nzm,1,nx+2,ncrms);
+  real5d uuu   = scratch.get("uuu"  ,ntr,nzm,1,nx+5,ncrms);
+  real5d www   = scratch.get("www"  ,ntr,nz,1,nx+4,ncrms);
+  real2d iadz  = scratch.get("iadz" ,nzm,ncrms);
+  real2d irho  = scratch.get("irho" ,nzm,ncrms);
+  real2d irhow = scratch.get("irhow",nzm,ncrms);
+
+  // for (int t=0; t<ntr; t++) {
+  //   for (int i=0; i<nx+4; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ntr,nx+4,ncrms) , YAKL_LAMBDA (int t, int i, int icrm) {
+    www(t,nz-1,j,i,icrm)=0.0;
   });
 
   if (dowallx) {
@@ -444,33 +454,37 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
 
   if (nonos) {
     
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //    for (int i=0; i<nx+2; i++) {
+    //      for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(ntr,nzm,nx+2,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+      int l = inds(t);
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
+      mx(t,k,j,i,icrm)=max(f(l,k,j,ib+offx_s-1,icrm),max(f(l,k,j,ic+offx_s-1,icrm),max(f(l,kb,j,i+offx_s-1,icrm),
+                     max(f(l,kc,j,i+offx_s-1,icrm),f(l,k,j,i+offx_s-1,icrm)))));
+      mn(t,k,j,i,icrm)=min(f(l,k,j,ib+offx_s-1,icrm),min(f(l,k,j,ic+offx_s-1,icrm),min(f(l,kb,j,i+offx_s-1,icrm),
+                     min(f(l,kc,j,i+offx_s-1,icrm),f(l,k,j,i+offx_s-1,icrm)))));
     });
   }// nonos
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+5; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //    for (int i=0; i<nx+5; i++) {
+  //      for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(ntr,nzm,nx+5,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+    int l = inds(t);
     int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+    uuu(t,k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(l,k,j,i-1+offx_s-2,icrm)+
+                    min(0.0,u(k,j,i,icrm))*f(l,k,j,i+offx_s-2,icrm);
     if (i <= nx+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+min(0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+      www(t,k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(l,kb,j,i+offx_s-2,icrm)+min(0.0,w(k,j,i,icrm))*f(l,k,j,i+offx_s-2,icrm);
     }
     if (i == 1) {
-      flux(ind_flux,k,icrm) = 0.0;
+      flux(l,k,icrm) = 0.0;
     }
   });
 
@@ -483,105 +497,118 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
   });
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //    for (int i=0; i<nx+4; i++) {
+  //      for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(ntr,nzm,nx+4,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+    int l = inds(t);
     if (i >= 2 && i <= nx+1) {
-      yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(l,k,icrm),www(t,k,j,i,icrm));
     }
-    f(ind_f,k,j,i+offx_s-2,icrm) = f(ind_f,k,j,i+offx_s-2,icrm) - (uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
-                                   (www(k+1,j,i,icrm)-www(k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
+    f(l,k,j,i+offx_s-2,icrm) = f(l,k,j,i+offx_s-2,icrm) - (uuu(t,k,j,i+1,icrm)-uuu(t,k,j,i,icrm) +
+                                   (www(t,k+1,j,i,icrm)-www(t,k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
   });
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int i=0; i<nx+3; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx+3,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //    for (int i=0; i<nx+3; i++) {
+  //      for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(ntr,nzm,nx+3,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+    int l = inds(t);
     int kc=min(nzm-1,k+1);
     int kb=max(0,k-1);
     real dd=2.0/(kc-kb)/adz(k,icrm);
     int ib=i-1;
-    uuu(k,j,i+offx_uuu-1,icrm) = 
-         andiff2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),u(k,j,i+offx_u-1,icrm),irho(k,icrm)) - 
-         across2(dd*(f(ind_f,kc,j,ib+offx_s-1,icrm)+f(ind_f,kc,j,i+offx_s-1,icrm)-
-                 f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,kb,j,i+offx_s-1,icrm)),
+    uuu(t,k,j,i+offx_uuu-1,icrm) = 
+         andiff2(f(l,k,j,ib+offx_s-1,icrm),f(l,k,j,i+offx_s-1,icrm),u(k,j,i+offx_u-1,icrm),irho(k,icrm)) - 
+         across2(dd*(f(l,kc,j,ib+offx_s-1,icrm)+f(l,kc,j,i+offx_s-1,icrm)-
+                 f(l,kb,j,ib+offx_s-1,icrm)-f(l,kb,j,i+offx_s-1,icrm)),
                  u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+
                  w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
     if (i <= nxp1) {
       int ic=i+1;
-      www(k,j,i+offx_www-1,icrm) = 
-         andiff2(f(ind_f,kb,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) - 
-         across2(f(ind_f,kb,j,ic+offx_s-1,icrm)+f(ind_f,k,j,ic+offx_s-1,icrm)-
-                 f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,k,j,ib+offx_s-1,icrm),
+      www(t,k,j,i+offx_www-1,icrm) = 
+         andiff2(f(l,kb,j,i+offx_s-1,icrm),f(l,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) - 
+         across2(f(l,kb,j,ic+offx_s-1,icrm)+f(l,k,j,ic+offx_s-1,icrm)-
+                 f(l,kb,j,ib+offx_s-1,icrm)-f(l,k,j,ib+offx_s-1,icrm),
                  w(k,j,i+offx_w-1,icrm), u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+
                  u(k,j,ic+offx_u-1,icrm)+u(kb,j,ic+offx_u-1,icrm)) *irho(k,icrm);
     }
   });
 
-  //  for (int i=0; i<nx+4; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
+  // for (int t=0; t<ntr; t++) {
+  //    for (int i=0; i<nx+4; i++) {
+  //      for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ntr,nx+4,ncrms) , YAKL_LAMBDA (int t, int i, int icrm) {
+    www(t,0,j,i,icrm) = 0.0;
   });
 
   if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //    for (int i=0; i<nx+2; i++) {
+    //      for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(ntr,nzm,nx+2,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+      int l = inds(t);
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
+      mx(t,k,j,i,icrm)=max(f(l,k,j,ib+offx_s-1,icrm),max(f(l,k,j,ic+offx_s-1,icrm),max(f(l,kb,j,i+offx_s-1,icrm),
+                     max(f(l,kc,j,i+offx_s-1,icrm),max(f(l,k,j,i+offx_s-1,icrm),mx(t,k,j,i,icrm))))));
+      mn(t,k,j,i,icrm)=min(f(l,k,j,ib+offx_s-1,icrm),min(f(l,k,j,ic+offx_s-1,icrm),min(f(l,kb,j,i+offx_s-1,icrm),
+                     min(f(l,kc,j,i+offx_s-1,icrm),min(f(l,k,j,i+offx_s-1,icrm),mn(t,k,j,i,icrm))))));
     });
 
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+2; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //    for (int i=0; i<nx+2; i++) {
+    //      for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(ntr,nzm,nx+2,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+      int l = inds(t);
       int kc=min(nzm-1,k+1);
       int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
-                     pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
-                     pn2(www(k,j,i+offx_www-1,icrm)))+eps);
+      mx(t,k,j,i,icrm)=rho(k,icrm)*(mx(t,k,j,i,icrm)-f(l,k,j,i+offx_s-1,icrm))/(pn2(uuu(t,k,j,ic+offx_uuu-1,icrm)) +
+                     pp2(uuu(t,k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(t,kc,j,i+offx_www-1,icrm)) +
+                     pp2(www(t,k,j,i+offx_www-1,icrm)))+eps);
+      mn(t,k,j,i,icrm)=rho(k,icrm)*(f(l,k,j,i+offx_s-1,icrm)-mn(t,k,j,i,icrm))/(pp2(uuu(t,k,j,ic+offx_uuu-1,icrm)) +
+                     pn2(uuu(t,k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(t,kc,j,i+offx_www-1,icrm)) +
+                     pn2(www(t,k,j,i+offx_www-1,icrm)))+eps);
     });
 
-    // for (int k=0; k<nzm; k++) {
-    //  for (int i=0; i<nx+1; i++) {
-    //    for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //    for (int i=0; i<nx+1; i++) {
+    //      for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(ntr,nzm,nx+1,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+      int l = inds(t);
       int ib=i-1;
-      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-                                pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+      uuu(t,k,j,i+offx_uuu,icrm)= pp2(uuu(t,k,j,i+offx_uuu,icrm))*min(1.0,min(mx(t,k,j,i+offx_m,icrm), mn(t,k,j,ib+offx_m,icrm))) -
+                                pn2(uuu(t,k,j,i+offx_uuu,icrm))*min(1.0,min(mx(t,k,j,ib+offx_m,icrm),mn(t,k,j,i+offx_m,icrm)));
       if (i <= nx-1) {
         int kb=max(0,k-1);
-        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-                                  pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+        www(t,k,j,i+offx_www,icrm)= pp2(www(t,k,j,i+offx_www,icrm))*min(1.0,min(mx(t,k,j,i+offx_m,icrm), mn(t,kb,j,i+offx_m,icrm))) -
+                                  pn2(www(t,k,j,i+offx_www,icrm))*min(1.0,min(mx(t,kb,j,i+offx_m,icrm),mn(t,k,j,i+offx_m,icrm)));
 
-        yakl::atomicAdd(flux(ind_flux,k,icrm), www(k,j,i+offx_www,icrm));
+        yakl::atomicAdd(flux(l,k,icrm), www(t,k,j,i+offx_www,icrm));
       }
     });
   } // nonos
 
-  // for (int k=0; k<nzm; k++) {
-  //     for (int i=0; i<nx; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //       for (int i=0; i<nx; i++) {
+  //         for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(ntr,nzm,nx,ncrms) , YAKL_LAMBDA (int t, int k, int i, int icrm) {
+    int l = inds(t);
     int kc=k+1;
     // MK: added fix for very small negative values (relative to positive values)
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
-    f(ind_f,k,j,i+offx_s,icrm)= max(0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
-                                (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
+    f(l,k,j,i+offx_s,icrm)= max(0.0, f(l,k,j,i+offx_s,icrm) - (uuu(t,k,j,i+1+offx_uuu,icrm)-uuu(t,k,j,i+offx_uuu,icrm) +
+                                (www(t,k+1,j,i+offx_www,icrm)-www(t,k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
 
 }
@@ -23,14 +23,16 @@ void advect_scalar3D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch;
+
+  real4d mx    = scratch.get("mx"   ,nzm,ny+2,nx+2,ncrms);
+  real4d mn    = scratch.get("mn"   ,nzm,ny+2,nx+2,ncrms);
+  real4d uuu   = scratch.get("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  real4d vvv   = scratch.get("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  real4d www   = scratch.get("www"  ,nz ,ny+4,nx+4,ncrms);
+  real2d iadz  = scratch.get("iadz" ,nzm,ncrms);
+  real2d irho  = scratch.get("irho" ,nzm,ncrms);
+  real2d irhow = scratch.get("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -320,14 +322,16 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch;
+
+  real4d mx    = scratch.get("mx"   ,nzm,ny+2,nx+2,ncrms);
+  real4d mn    = scratch.get("mn"   ,nzm,ny+2,nx+2,ncrms);
+  real4d uuu   = scratch.get("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  real4d vvv   = scratch.get("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  real4d www   = scratch.get("www"  ,nz ,ny+4,nx+4,ncrms);
+  real2d iadz  = scratch.get("iadz" ,nzm,ncrms);
+  real2d irho  = scratch.get("irho" ,nzm,ncrms);
+  real2d irhow = scratch.get("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -594,7 +598,10 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
 
 }
 
-void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
+// Batched version: advects the tracers f(inds(t),...), t=0,...,ntr-1, in the same set of kernels.
+// The velocity boundary conditions and the inverse density/layer thickness are computed only once.
+// Each tracer is advected independently, so the result is the same as advecting them one by one.
+void advect_scalar3D(real5d &f, int1d &inds, int ntr, real3d &flux) {
   YAKL_SCOPE( dowallx  , ::dowallx);
   YAKL_SCOPE( dowally  , ::dowally);
   YAKL_SCOPE( rank     , ::rank);
@@ -617,21 +624,24 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(nz-1,j,i,icrm)=0.0;
+  ScratchScope scratch;
+
+  real5d mx    = scratch.get("mx"   ,ntr,nzm,ny+2,nx+2,ncrms);
+  real5d mn    = scratch.get("mn"   ,ntr,nzm,ny+2,nx+2,ncrms);
+  real5d uuu   = scratch.get("uuu"  ,ntr,nzm,ny+4,nx+5,ncrms);
+  real5d vvv   = scratch.get("vvv"  ,ntr,nzm,ny+5,nx+4,ncrms);
+  real5d www   = scratch.get("www"  ,ntr,nz ,ny+4,nx+4,ncrms);
+  real2d iadz  = scratch.get("iadz" ,nzm,ncrms);
+  real2d irho  = scratch.get("irho" ,nzm,ncrms);
+  real2d irhow = scratch.get("irhow",nzm,ncrms);
+
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int j=0; j<ny+4; j++) {
+  //       for (int i=0; i<nx+4; i++) {
+  //         for(int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<5>(ntr,nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+    www(t,nz-1,j,i,icrm)=0.0;
   });
 
   if (dowallx) {
@@ -679,50 +689,54 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   }
 
   if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<ny+2; j++) {
+    //       for (int i=0; i<nx+2; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+      int l = inds(t);
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int jb=j-1;
       int jc=j+1;
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm) = 
-           max(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-           max(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
-           max(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-                                                          f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)))))));
-      mn(k,j,i,icrm) = 
-           min(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-           min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
-           min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-                                                          f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)))))));
+      mx(t,k,j,i,icrm) = 
+           max(f(l,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(l,k,j+offy_s-1,ic+offx_s-1,icrm),
+           max(f(l,k,jb+offy_s-1,i+offx_s-1,icrm),max(f(l,k,jc+offy_s-1,i+offx_s-1,icrm),
+           max(f(l,kb,j+offy_s-1,i+offx_s-1,icrm),max(f(l,kc,j+offy_s-1,i+offx_s-1,icrm),
+                                                          f(l,k,j+offy_s-1,i+offx_s-1,icrm)))))));
+      mn(t,k,j,i,icrm) = 
+           min(f(l,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(l,k,j+offy_s-1,ic+offx_s-1,icrm),
+           min(f(l,k,jb+offy_s-1,i+offx_s-1,icrm),min(f(l,k,jc+offy_s-1,i+offx_s-1,icrm),
+           min(f(l,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(l,kc,j+offy_s-1,i+offx_s-1,icrm),
+                                                          f(l,k,j+offy_s-1,i+offx_s-1,icrm)))))));
     });
   } 
 
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+5; j++) {
-  //     for (int i=0; i<nx+5; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int j=0; j<ny+5; j++) {
+  //       for (int i=0; i<nx+5; i++) {
+  //         for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<5>(ntr,nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+    int l = inds(t);
     int kb=max(0,k-1);
     if (j <= ny+3){
-      uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
-                      min(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      uuu(t,k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(l,k,j+offy_s-2,i-1+offx_s-2,icrm)+
+                      min(0.0,u(k,j,i,icrm))*f(l,k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i <= nx+3) {
-      vvv(k,j,i,icrm)=max(0.0,v(k,j,i,icrm))*f(ind_f,k,j-1+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,v(k,j,i,icrm))*f(ind_f,k,j+offx_s-2,i+offy_s-2,icrm);
+      vvv(t,k,j,i,icrm)=max(0.0,v(k,j,i,icrm))*f(l,k,j-1+offy_s-2,i+offx_s-2,icrm)+
+                      min(0.0,v(k,j,i,icrm))*f(l,k,j+offx_s-2,i+offy_s-2,icrm);
     }
     if (i <= nx+3 && j <= ny+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,w(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      www(t,k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(l,kb,j+offy_s-2,i+offx_s-2,icrm)+
+                      min(0.0,w(k,j,i,icrm))*f(l,k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i == 0 && j == 0) {
-      flux(ind_flux,k,icrm) = 0.0;
+      flux(l,k,icrm) = 0.0;
     }
   });
 
@@ -734,24 +748,28 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
   });
 
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int j=0; j<ny+4; j++) {
+  //       for (int i=0; i<nx+4; i++) {
+  //         for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<5>(ntr,nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+    int l = inds(t);
     if (i >= 2 && i <= nx+1 && j >= 2 && j <= ny+1) {
-      yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(l,k,icrm),www(t,k,j,i,icrm));
     }
-    f(ind_f,k,j+offy_s-2,i+offy_s-2,icrm)=f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm)-( uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
-                                    vvv(k,j+1,i,icrm)-vvv(k,j,i,icrm)
-                                    +(www(k+1,j,i,icrm)-www(k,j,i,icrm) )*iadz(k,icrm))*irho(k,icrm);
+    f(l,k,j+offy_s-2,i+offy_s-2,icrm)=f(l,k,j+offy_s-2,i+offx_s-2,icrm)-( uuu(t,k,j,i+1,icrm)-uuu(t,k,j,i,icrm) +
+                                    vvv(t,k,j+1,i,icrm)-vvv(t,k,j,i,icrm)
+                                    +(www(t,k+1,j,i,icrm)-www(t,k,j,i,icrm) )*iadz(k,icrm))*irho(k,icrm);
   });
 
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny+3; j++) {
-  //     for (int i=0; i<nx+3; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+3,nx+3,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int j=0; j<ny+3; j++) {
+  //       for (int i=0; i<nx+3; i++) {
+  //         for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<5>(ntr,nzm,ny+3,nx+3,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+    int l = inds(t);
     if (j <= ny+1) {
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
@@ -759,18 +777,18 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int jb=j-1;
       int jc=j+1;
       int ib=i-1;
-      uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm) = 
-           andiff(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
+      uuu(t,k,j+offy_uuu-1,i+offx_uuu-1,icrm) = 
+           andiff(f(l,k,j+offy_s-1,ib+offx_s-1,icrm),f(l,k,j+offy_s-1,i+offx_s-1,icrm),
                   u(k,j+offy_u-1,i+offx_u-1,icrm),irho(k,icrm))-
-          (across(f(ind_f,k,jc+offy_s-1,ib+offx_s-1,icrm)+f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,k,jb+offy_s-1,ib+offx_s-1,icrm)-
-                  f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),u(k,j+offy_u-1,i+offx_u-1,icrm),
+          (across(f(l,k,jc+offy_s-1,ib+offx_s-1,icrm)+f(l,k,jc+offy_s-1,i+offx_s-1,icrm)-
+                  f(l,k,jb+offy_s-1,ib+offx_s-1,icrm)-
+                  f(l,k,jb+offy_s-1,i+offx_s-1,icrm),u(k,j+offy_u-1,i+offx_u-1,icrm),
                   v(k,j+offy_v-1,ib+offx_v-1,icrm)+
                   v(k,jc+offy_v-1,ib+offx_v-1,icrm)+v(k,jc+offy_v-1,i+offx_v-1,icrm)+
                   v(k,j+offy_v-1,i+offx_v-1,icrm))+
-           across(dd*(f(ind_f,kc,j+offy_s-1,ib+offx_s-1,icrm)+f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,kb,j+offy_s-1,ib+offx_s-1,icrm)-
-                  f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm)),u(k,j+offy_u-1,i+offx_u-1,icrm), 
+           across(dd*(f(l,kc,j+offy_s-1,ib+offx_s-1,icrm)+f(l,kc,j+offy_s-1,i+offx_s-1,icrm)-
+                  f(l,kb,j+offy_s-1,ib+offx_s-1,icrm)-
+                  f(l,kb,j+offy_s-1,i+offx_s-1,icrm)),u(k,j+offy_u-1,i+offx_u-1,icrm), 
                   w(k,j+offy_w-1,ib+offx_w-1,icrm)+
                   w(kc,j+offy_w-1,ib+offx_w-1,icrm)+w(k,j+offy_w-1,i+offx_w-1,icrm)+
                   w(kc,j+offy_w-1,i+offx_w-1,icrm))) *irho(k,icrm);
@@ -782,18 +800,18 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int jb=j-1;
       int ib=i-1;
       int ic=i+1;
-      vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm) = 
-           andiff(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
+      vvv(t,k,j+offy_vvv-1,i+offx_vvv-1,icrm) = 
+           andiff(f(l,k,jb+offy_s-1,i+offx_s-1,icrm),f(l,k,j+offy_s-1,i+offx_s-1,icrm),
                   v(k,j+offy_v-1,i+offx_v-1,icrm),irho(k,icrm))-
-           (across(f(ind_f,k,jb+offy_s-1,ic+offx_s-1,icrm)+f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm)-
-                   f(ind_f,k,jb+offy_s-1,ib+offx_s-1,icrm)-
-                   f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),v(k,j+offy_v-1,i+offx_v-1,icrm), 
+           (across(f(l,k,jb+offy_s-1,ic+offx_s-1,icrm)+f(l,k,j+offy_s-1,ic+offx_s-1,icrm)-
+                   f(l,k,jb+offy_s-1,ib+offx_s-1,icrm)-
+                   f(l,k,j+offy_s-1,ib+offx_s-1,icrm),v(k,j+offy_v-1,i+offx_v-1,icrm), 
                    u(k,jb+offy_u-1,i+offx_u-1,icrm)+
                    u(k,j+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,ic+offx_u-1,icrm)+
                    u(k,jb+offy_u-1,ic+offx_u-1,icrm))+
-            across(dd*(f(ind_f,kc,jb+offy_s-1,i+offx_s-1,icrm)+f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm)-
-                   f(ind_f,kb,jb+offy_s-1,i+offx_s-1,icrm)-
-                   f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm)),v(k,j+offy_v-1,i+offx_v-1,icrm), 
+            across(dd*(f(l,kc,jb+offy_s-1,i+offx_s-1,icrm)+f(l,kc,j+offy_s-1,i+offx_s-1,icrm)-
+                   f(l,kb,jb+offy_s-1,i+offx_s-1,icrm)-
+                   f(l,kb,j+offy_s-1,i+offx_s-1,icrm)),v(k,j+offy_v-1,i+offx_v-1,icrm), 
                    w(k,jb+offy_w-1,i+offx_w-1,icrm)+
                    w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm)+
                    w(kc,jb+offy_w-1,i+offx_w-1,icrm))) *irho(k,icrm);
@@ -804,126 +822,135 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int jc=j+1;
       int ib=i-1;
       int ic=i+1;
-      www(k,j+offy_www-1,i+offx_www-1,icrm) = 
-           andiff(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
+      www(t,k,j+offy_www-1,i+offx_www-1,icrm) = 
+           andiff(f(l,kb,j+offy_s-1,i+offx_s-1,icrm),f(l,k,j+offy_s-1,i+offx_s-1,icrm),
                   w(k,j+offy_w-1,i+offx_w-1,icrm),irhow(k,icrm))-
-          (across(f(ind_f,kb,j+offy_s-1,ic+offx_s-1,icrm)+f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm)-
-                  f(ind_f,kb,j+offy_s-1,ib+offx_s-1,icrm)-
-                  f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),w(k,j+offy_w-1,i+offx_w-1,icrm), 
+          (across(f(l,kb,j+offy_s-1,ic+offx_s-1,icrm)+f(l,k,j+offy_s-1,ic+offx_s-1,icrm)-
+                  f(l,kb,j+offy_s-1,ib+offx_s-1,icrm)-
+                  f(l,k,j+offy_s-1,ib+offx_s-1,icrm),w(k,j+offy_w-1,i+offx_w-1,icrm), 
                   u(kb,j+offy_u-1,i+offx_u-1,icrm)+
                   u(k,j+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,ic+offx_u-1,icrm)+
                   u(kb,j+offy_u-1,ic+offx_u-1,icrm))+
-           across(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm)+f(ind_f,kb,jc+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,kb,jb+offy_s-1,i+offx_s-1,icrm),w(k,j+offy_w-1,i+offx_w-1,icrm), 
+           across(f(l,k,jc+offy_s-1,i+offx_s-1,icrm)+f(l,kb,jc+offy_s-1,i+offx_s-1,icrm)-
+                  f(l,k,jb+offy_s-1,i+offx_s-1,icrm)-
+                  f(l,kb,jb+offy_s-1,i+offx_s-1,icrm),w(k,j+offy_w-1,i+offx_w-1,icrm), 
                   v(kb,j+offy_v-1,i+offx_v-1,icrm)+
                   v(kb,jc+offy_v-1,i+offx_v-1,icrm)+v(k,jc+offy_v-1,i+offx_v-1,icrm)+
                   v(k,j+offy_v-1,i+offx_v-1,icrm))) *irho(k,icrm);
     }
   });
 
-  //   for (int j=0; j<ny+4; j++) {
-  //     for (int i=0; i<nx+4; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    www(0,j,i,icrm) = 0.0;
+  // for (int t=0; t<ntr; t++) {
+  //     for (int j=0; j<ny+4; j++) {
+  //       for (int i=0; i<nx+4; i++) {
+  //         for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<5>(ntr,nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+    www(t,0,j,i,icrm) = 0.0;
   });
 
   if (nonos) {
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<ny+2; j++) {
+    //       for (int i=0; i<nx+2; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+      int l = inds(t);
       int kc=min(nzm-1,k+1);
       int kb=max(0,k-1);
       int jb=j-1;
       int jc=j+1;
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm) = 
-          max(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-          max(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
-          max(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),
-          max(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-          max(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mx(k,j,i,icrm))))))));
-      mn(k,j,i,icrm) = 
-          min(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-          min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
-          min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),
-          min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-          min(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mn(k,j,i,icrm))))))));
+      mx(t,k,j,i,icrm) = 
+          max(f(l,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(l,k,j+offy_s-1,ic+offx_s-1,icrm),
+          max(f(l,k,jb+offy_s-1,i+offx_s-1,icrm),
+          max(f(l,k,jc+offy_s-1,i+offx_s-1,icrm),max(f(l,kb,j+offy_s-1,i+offx_s-1,icrm),
+          max(f(l,kc,j+offy_s-1,i+offx_s-1,icrm),
+          max(f(l,k,j+offy_s-1,i+offx_s-1,icrm),mx(t,k,j,i,icrm))))))));
+      mn(t,k,j,i,icrm) = 
+          min(f(l,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(l,k,j+offy_s-1,ic+offx_s-1,icrm),
+          min(f(l,k,jb+offy_s-1,i+offx_s-1,icrm),
+          min(f(l,k,jc+offy_s-1,i+offx_s-1,icrm),min(f(l,kb,j+offy_s-1,i+offx_s-1,icrm),
+          min(f(l,kc,j+offy_s-1,i+offx_s-1,icrm),
+          min(f(l,k,j+offy_s-1,i+offx_s-1,icrm),mn(t,k,j,i,icrm))))))));
     });
 
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+2; j++) {
-    //     for (int i=0; i<nx+2; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<ny+2; j++) {
+    //       for (int i=0; i<nx+2; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+      int l = inds(t);
       int kc=min(nzm-1,k+1);
       int jc=j+1;
       int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm))/
-                ( pn3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pp3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
-                  pn3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pp3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
-                 (pn3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pp3(www(k,j+offy_www-1,i+offx_www-1,icrm)))
+      mx(t,k,j,i,icrm)=rho(k,icrm)*(mx(t,k,j,i,icrm)-f(l,k,j+offy_s-1,i+offx_s-1,icrm))/
+                ( pn3(uuu(t,k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pp3(uuu(t,k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
+                  pn3(vvv(t,k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pp3(vvv(t,k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
+                 (pn3(www(t,kc,j+offy_www-1,i+offx_www-1,icrm)) + pp3(www(t,k,j+offy_www-1,i+offx_www-1,icrm)))
                  *iadz(k,icrm)+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)-mn(k,j,i,icrm))/
-                ( pp3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pn3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
-                  pp3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pn3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
-                 (pp3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pn3(www(k,j+offy_www-1,i+offx_www-1,icrm)))
+      mn(t,k,j,i,icrm)=rho(k,icrm)*(f(l,k,j+offy_s-1,i+offx_s-1,icrm)-mn(t,k,j,i,icrm))/
+                ( pp3(uuu(t,k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pn3(uuu(t,k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
+                  pp3(vvv(t,k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pn3(vvv(t,k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
+                 (pp3(www(t,kc,j+offy_www-1,i+offx_www-1,icrm)) + pn3(www(t,k,j+offy_www-1,i+offx_www-1,icrm)))
                  *iadz(k,icrm)+eps);
     });
 
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny+1; j++) {
-    //     for (int i=0; i<nx+1; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny+1,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    // for (int t=0; t<ntr; t++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<ny+1; j++) {
+    //       for (int i=0; i<nx+1; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,ny+1,nx+1,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+      int l = inds(t);
       if (j <= ny-1) {
         int ib=i-1;
-        uuu(k,j+offy_uuu,i+offx_uuu,icrm) = 
-              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
-              mn(k,j+offy_m,ib+offx_m,icrm)))
-             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),
-             mn(k,j+offy_m,i+offx_m,icrm)));
+        uuu(t,k,j+offy_uuu,i+offx_uuu,icrm) = 
+              pp3(uuu(t,k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(t,k,j+offy_m,i+offx_m,icrm), 
+              mn(t,k,j+offy_m,ib+offx_m,icrm)))
+             -pn3(uuu(t,k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(t,k,j+offy_m,ib+offx_m,icrm),
+             mn(t,k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1) {
         int jb=j-1;
-        vvv(k,j+offy_vvv,i+offx_vvv,icrm) =
-              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
-              mn(k,jb+offy_m,i+offx_m,icrm)))
-             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),
-             mn(k,j+offy_m,i+offx_m,icrm)));
+        vvv(t,k,j+offy_vvv,i+offx_vvv,icrm) =
+              pp3(vvv(t,k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(t,k,j+offy_m,i+offx_m,icrm), 
+              mn(t,k,jb+offy_m,i+offx_m,icrm)))
+             -pn3(vvv(t,k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(t,k,jb+offy_m,i+offx_m,icrm),
+             mn(t,k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1 && j <= ny-1) {
         int kb=max(0,k-1);
-        www(k,j+offy_www,i+offx_www,icrm) =
-              pp3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
-              mn(kb,j+offy_m,i+offx_m,icrm)))
-             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),
-             mn(k,j+offy_m,i+offx_m,icrm)));
-        yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j+offy_www,i+offx_www,icrm));
+        www(t,k,j+offy_www,i+offx_www,icrm) =
+              pp3(www(t,k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(t,k,j+offy_m,i+offx_m,icrm), 
+              mn(t,kb,j+offy_m,i+offx_m,icrm)))
+             -pn3(www(t,k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(t,kb,j+offy_m,i+offx_m,icrm),
+             mn(t,k,j+offy_m,i+offx_m,icrm)));
+        yakl::atomicAdd(flux(l,k,icrm),www(t,k,j+offy_www,i+offx_www,icrm));
       }
     });
   }
 
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny; j++) {
-  //     for (int i=0; i<nx; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+  // for (int t=0; t<ntr; t++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int j=0; j<ny; j++) {
+  //       for (int i=0; i<nx; i++) {
+  //         for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<5>(ntr,nzm,ny,nx,ncrms) , YAKL_LAMBDA (int t, int k, int j, int i, int icrm) {
+    int l = inds(t);
     // MK: added fix for very small negative values (relative to positive values)
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
     int kc=k+1;
-    f(ind_f,k,j+offy_s,i+offx_s,icrm) = 
-         max(0.0,f(ind_f,k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-
-                 uuu(k,j+offy_uuu,i+offx_uuu,icrm)+
-                 vvv(k,j+offy_vvv+1,i+offx_vvv,icrm)-vvv(k,j+offy_vvv,i+offx_vvv,icrm)+
-                 (www(k+1,j+offy_www,i+offx_www,icrm)-
-                 www(k,j+offy_www,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
+    f(l,k,j+offy_s,i+offx_s,icrm) = 
+         max(0.0,f(l,k,j+offy_s,i+offx_s,icrm) -(uuu(t,k,j+offy_uuu,i+offx_uuu+1,icrm)-
+                 uuu(t,k,j+offy_uuu,i+offx_uuu,icrm)+
+                 vvv(t,k,j+offy_vvv+1,i+offx_vvv,icrm)-vvv(t,k,j+offy_vvv,i+offx_vvv,icrm)+
+                 (www(t,k+1,j+offy_www,i+offx_www,icrm)-
+                 www(t,k,j+offy_www,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
 
 }
@@ -1,6 +1,75 @@
 
 #include "pressure.h"
 
+#ifdef USE_ORIG_FFT
+
+#include <vector>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Factors and twiddles for fft991_crm. They only depend on the (compile-time)
+// global grid size, so each set is computed once, the first time it is needed.
+struct HostFFTFactors {
+  std::vector<real> trigs;
+  std::vector<int>  ifax;
+  HostFFTFactors(int n) : trigs(3*n/2+1), ifax(100) {
+    fftfax_crm( n , ifax.data() , trigs.data() );
+  }
+};
+
+// Real/half-complex transforms along x of all the (k,j,icrm) lines of fHost(nzslab,ny2,nx2,ncrms).
+// For fixed (k,j), the ncrms lines are interleaved (inc=ncrms, jump=1), so they are
+// transformed by a single multi-line fft991_crm call. Calls are threaded over (k,j), unless
+// we are already inside a parallel region (e.g., the threaded physics chunk loop).
+void pressure_host_fft_x(realHost4d &fHost, int nzslab, int ny2, int nx2, int isign) {
+  static HostFFTFactors fac(nx_gl);
+  int const lot = ncrms;
+  real *fdata = fHost.data();
+
+  #pragma omp parallel if(!omp_in_parallel())
+  {
+    std::vector<real> work((nx_gl+1)*lot);
+
+    #pragma omp for collapse(2)
+    for (int k = 0 ; k < nzslab ; k++) {
+      for (int j = 0 ; j < ny_gl ; j++) {
+        real *line0 = fdata + ((size_t) k*ny2 + j)*nx2*ncrms;
+        fft991_crm( line0 , work.data() , fac.trigs.data() , fac.ifax.data() , ncrms , 1 , nx_gl , lot , isign );
+      }
+    }
+  }
+}
+
+// Real/half-complex transforms along y of all the (k,i,icrm) lines of fHost(nzslab,ny2,nx2,ncrms).
+// For fixed k, the lines over (i,icrm) are contiguous (inc=nx2*ncrms, jump=1), so they are
+// transformed in chunks of up to max_lot lines per fft991_crm call. Calls are threaded over (k,chunk),
+// unless we are already inside a parallel region.
+void pressure_host_fft_y(realHost4d &fHost, int nzslab, int ny2, int nx2, int isign) {
+  static HostFFTFactors fac(ny_gl);
+  int constexpr max_lot = 64;
+  int const nlines  = (nx_gl+1)*ncrms;
+  int const nchunks = (nlines+max_lot-1)/max_lot;
+  real *fdata = fHost.data();
+
+  #pragma omp parallel if(!omp_in_parallel())
+  {
+    std::vector<real> work((ny_gl+1)*max_lot);
+
+    #pragma omp for collapse(2)
+    for (int k = 0 ; k < nzslab ; k++) {
+      for (int c = 0 ; c < nchunks ; c++) {
+        int lot = std::min(max_lot, nlines-c*max_lot);
+        real *line0 = fdata + (size_t) k*ny2*nx2*ncrms + c*max_lot;
+        fft991_crm( line0 , work.data() , fac.trigs.data() , fac.ifax.data() , nx2*ncrms , 1 , ny_gl , lot , isign );
+      }
+    }
+  }
+}
+
+#endif
+
 void pressure() {
   YAKL_SCOPE( p             , :: p );
   YAKL_SCOPE( rhow          , :: rhow );
@@ -16,14 +85,14 @@ void pressure() {
   int nzslab = max(1,nzm/npressureslabs); 
   int nx2 = nx+2;
   int ny2 = ny+2*YES3D;
-  int constexpr n3i=3*nx_gl/2+1;
-  int constexpr n3j=3*ny_gl/2+1;
   int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
+  ScratchScope scratch;
+
+  real4d f  = scratch.get("f" , nzslab, ny2, nx2, ncrms);
+  real4d ff = scratch.get("ff", nzm,ny2,nx+1,ncrms);
+  real2d a  = scratch.get("a" , nzm, ncrms);
+  real2d c  = scratch.get("c" , nzm, ncrms);
 
   int iwall = 0;
   int nypp, jwall;
@@ -35,7 +104,7 @@ void pressure() {
     nypp = ny+2;
   }
 
-  real2d eign("eign",nypp,nx+1);
+  real2d eign = scratch.get("eign",nypp,nx+1);
 
   press_rhs();
 
@@ -54,40 +123,16 @@ void pressure() {
 
   #else
 
-    realHost2d work  ("work"  ,ny2,nx2);
-    realHost1d ftmp_x("ftmp_x",nx2);
-    realHost1d ftmp_y("ftmp_y",ny2);
-    realHost1d trigxi("trigxi",n3i);
-    realHost1d trigxj("trigxj",n3j);
-    intHost1d  ifaxi ("ifaxi" ,100);
-    intHost1d  ifaxj ("ifaxj" ,100);
-    realHost4d fHost = f.createHostCopy();
+    // Host copy of f. Its size does not change across calls, so the buffer is persistent.
+    static std::vector<real> fHost_buf;
+    fHost_buf.resize((size_t) nzslab*ny2*nx2*ncrms);
+    realHost4d fHost("fHost", fHost_buf.data(), nzslab, ny2, nx2, ncrms);
+    f.deep_copy_to(fHost);
 
     yakl::fence();
 
-    fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
-    if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
-
-    for (int k = 0 ; k < nzslab ; k++) {
-      for (int j = 0 ; j < ny_gl ; j++) {
-        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-          for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
-          fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , -1 );
-          for (int i=0 ; i < nx2 ; i++) { fHost(k,j,i,icrm) = ftmp_x(i); }
-        }
-      }
-    }
-    if (RUN3D) {
-      for (int k = 0 ; k < nzslab ; k++) {
-        for (int i = 0 ; i < nx_gl+1 ; i++) {
-          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-            for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
-            fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , -1);
-            for (int j=0 ; j < ny2 ; j++) { fHost(k,j,i,icrm) = ftmp_y(j); }
-          }
-        }
-      }
-    }
+    pressure_host_fft_x(fHost, nzslab, ny2, nx2, -1);
+    if (RUN3D) { pressure_host_fft_y(fHost, nzslab, ny2, nx2, -1); }
 
     fHost.deep_copy_to(f);
 
@@ -182,27 +227,8 @@ void pressure() {
     f.deep_copy_to(fHost);
     yakl::fence();
 
-    if (RUN3D) {
-      for (int k = 0 ; k < nzslab ; k++) {
-        for (int i = 0 ; i < nx_gl+1 ; i++) {
-          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-            for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
-            fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , +1);
-            for (int j=0 ; j < ny2 ; j++) { fHost(k,j,i,icrm) = ftmp_y(j); }
-          }
-        }
-      }
-    }
-
-    for (int k = 0 ; k < nzslab ; k++) {
-      for (int j = 0 ; j < ny_gl ; j++) {
-        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-          for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
-          fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , +1);
-          for (int i=0 ; i < nx2 ; i++) { fHost(k,j,i,icrm) = ftmp_x(i); }
-        }
-      }
-    }
+    if (RUN3D) { pressure_host_fft_y(fHost, nzslab, ny2, nx2, +1); }
+    pressure_host_fft_x(fHost, nzslab, ny2, nx2, +1);
 
     fHost.deep_copy_to(f);
 
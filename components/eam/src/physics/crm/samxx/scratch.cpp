@@ -0,0 +1,47 @@
+
+#include "scratch.h"
+#include <algorithm>
+
+namespace {
+  // Checkouts are aligned to this many reals
+  size_t constexpr scratch_align = 16;
+
+  real1d scratch_pool;
+  size_t scratch_capacity   = 0;
+  size_t scratch_top        = 0;
+  // Largest top reached (including checkouts that did not fit). This is kept across
+  // calls to scratch_finalize, so that the pool is eventually large enough.
+  size_t scratch_high_water = 0;
+}
+
+void scratch_allocate(size_t nreals) {
+  scratch_capacity = std::max(nreals,scratch_high_water);
+  scratch_pool     = real1d("scratch_pool",scratch_capacity);
+  scratch_top      = 0;
+}
+
+void scratch_finalize() {
+  scratch_pool     = real1d();
+  scratch_capacity = 0;
+  scratch_top      = 0;
+}
+
+real *scratch_checkout(size_t nreals) {
+  size_t start = (scratch_top+scratch_align-1)/scratch_align*scratch_align;
+  size_t end   = start + nreals;
+  // Advance the top even if the checkout does not fit, so that the
+  // high water mark accounts for all the arrays in use at the same time
+  scratch_top        = end;
+  scratch_high_water = std::max(scratch_high_water,end);
+  if (end > scratch_capacity) { return nullptr; }
+  return scratch_pool.data() + start;
+}
+
+size_t scratch_get_top() {
+  return scratch_top;
+}
+
+void scratch_set_top(size_t top) {
+  scratch_top = top;
+}
+
@@ -0,0 +1,58 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include <cstddef>
+
+// Scratch space for the temporary arrays of the routines called every CRM substep
+// (advection, pressure, ...). A single device pool is allocated in allocate(), and
+// temporaries are checked out of it in stack order via a ScratchScope:
+//
+//   void foo() {
+//     ScratchScope scratch;
+//     real4d tmp = scratch.get("tmp",nzm,ny,nx,ncrms);
+//     ...
+//   } // tmp is returned to the pool here
+//
+// Arrays must not be used after their scope ends. Kernels are executed in order,
+// so memory returned to the pool can be reused right away by the next checkout.
+// If a checkout does not fit in the pool, a regular allocation is done instead,
+// and the pool is sized to fit it in the next call to allocate().
+// The pool is not thread safe, and is meant to be used by the thread calling crm().
+
+// Allocate the pool with (at least) nreals entries, and with at least the
+// largest size needed in previous calls
+void scratch_allocate(size_t nreals);
+
+void scratch_finalize();
+
+// Get nreals entries from the pool, or nullptr if they do not fit
+real *scratch_checkout(size_t nreals);
+
+size_t scratch_get_top();
+
+void scratch_set_top(size_t top);
+
+
+class ScratchScope {
+public:
+  ScratchScope() : mark(scratch_get_top()) {}
+  ~ScratchScope() { scratch_set_top(mark); }
+
+  ScratchScope(ScratchScope const &) = delete;
+  ScratchScope &operator=(ScratchScope const &) = delete;
+
+  template <class... DIMS>
+  yakl::Array<real,sizeof...(DIMS),yakl::memDevice,yakl::styleC> get(char const *label, DIMS... dims) {
+    typedef yakl::Array<real,sizeof...(DIMS),yakl::memDevice,yakl::styleC> array_type;
+    size_t nreals = 1;
+    for (size_t d : {static_cast<size_t>(dims)...}) { nreals *= d; }
+    real *ptr = scratch_checkout(nreals);
+    if (ptr == nullptr) { return array_type(label,dims...); }
+    return array_type(label,ptr,dims...);
+  }
+
+private:
+  size_t mark;
+};
+
@@ -29,6 +29,24 @@ cd ..
 printf "\nComparing results\n\n"
 python nccmp.py fortran2d/fortran_output_000001.nc cpp2d/cpp_output_000001.nc || exit -1
 
+printf "\nRunning C++ code with the host FFTs\n\n"
+cd cpp2d_orig_fft
+rm -f cpp_output_000001.nc cpp_output_threaded_000001.nc
+OMP_NUM_THREADS=4 mpirun -n $ntasks ./cpp2d_orig_fft || exit -1
+cd ..
+
+printf "\nComparing host FFT results\n\n"
+python nccmp.py cpp2d/cpp_output_000001.nc cpp2d_orig_fft/cpp_output_000001.nc || exit -1
+
+printf "\nRunning C++ code with serial host FFTs\n\n"
+cd cpp2d_orig_fft
+mv cpp_output_000001.nc cpp_output_threaded_000001.nc
+OMP_NUM_THREADS=1 mpirun -n $ntasks ./cpp2d_orig_fft || exit -1
+cd ..
+
+printf "\nComparing threaded and serial host FFT results\n\n"
+python nccmp.py cpp2d_orig_fft/cpp_output_000001.nc cpp2d_orig_fft/cpp_output_threaded_000001.nc || exit -1
+
 ################################################################################
 ################################################################################
 
@@ -49,5 +67,23 @@ cd ..
 printf "\nComparing results\n\n"
 python nccmp.py fortran3d/fortran_output_000001.nc cpp3d/cpp_output_000001.nc || exit -1
 
+printf "\nRunning C++ code with the host FFTs\n\n"
+cd cpp3d_orig_fft
+rm -f cpp_output_000001.nc cpp_output_threaded_000001.nc
+OMP_NUM_THREADS=4 mpirun -n $ntasks ./cpp3d_orig_fft || exit -1
+cd ..
+
+printf "\nComparing host FFT results\n\n"
+python nccmp.py cpp3d/cpp_output_000001.nc cpp3d_orig_fft/cpp_output_000001.nc || exit -1
+
+printf "\nRunning C++ code with serial host FFTs\n\n"
+cd cpp3d_orig_fft
+mv cpp_output_000001.nc cpp_output_threaded_000001.nc
+OMP_NUM_THREADS=1 mpirun -n $ntasks ./cpp3d_orig_fft || exit -1
+cd ..
+
+printf "\nComparing threaded and serial host FFT results\n\n"
+python nccmp.py cpp3d_orig_fft/cpp_output_000001.nc cpp3d_orig_fft/cpp_output_threaded_000001.nc || exit -1
+
 ################################################################################
 ################################################################################
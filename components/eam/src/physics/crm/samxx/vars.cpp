@@ -1,5 +1,6 @@
 
 #include "vars.h"
+#include "scratch.h"
 
 void allocate() {
   t00              = real2d( "t00                "      , nzm, ncrms);
@@ -52,6 +53,8 @@ void allocate() {
   qpsrc            = real2d( "qpsrc           " , nz, ncrms);
   qpevp            = real2d( "qpevp           " , nz, ncrms);
   flag_precip      = intHost1d( "flag_precip     " , nmicro_fields);
+  micro_adv_inds   = int1d( "micro_adv_inds  " , nmicro_fields);
+  micro_adv_inds_host = intHost1d( "micro_adv_inds_host" , nmicro_fields);
   u_esmt           = real4d( "u_esmt          ", nzm, dimy_s, dimx_s, ncrms);
   v_esmt           = real4d( "v_esmt          ", nzm, dimy_s, dimx_s, ncrms);
   u_esmt_sgs       = real2d( "u_esmt_sgs      ", nz, ncrms);
@@ -382,6 +385,13 @@ void allocate() {
   yakl::memset(t_vt              ,0.);
   yakl::memset(q_vt              ,0.);
   yakl::memset(u_vt              ,0.);
+
+  // Scratch space for temporaries, sized for the largest user: the batched advection
+  // of the microphysics fields (f0 in advect_scalar, plus the advect_scalar3D arrays),
+  // with room for the alignment of the checkouts
+  size_t adv_per_tracer = (size_t) nzm*dimy_s*dimx_s + 2*nzm*(ny+2)*(nx+2) +
+                          nzm*(ny+4)*(nx+5) + nzm*(ny+5)*(nx+4) + nz*(ny+4)*(nx+4);
+  scratch_allocate( (nmicro_fields*adv_per_tracer + 3*nzm + nz + 3) * ncrms + 16*16 );
 }
 
 
@@ -527,6 +537,8 @@ void finalize() {
   qpsrc            = real2d();
   qpevp            = real2d();
   flag_precip      = intHost1d();
+  micro_adv_inds   = int1d();
+  micro_adv_inds_host = intHost1d();
   fcorz            = real1d(); 
   fcor             = real1d(); 
   longitude0       = real1d(); 
@@ -669,6 +681,8 @@ void finalize() {
 
   yakl::fence();
 
+  scratch_finalize();
+
   pressure_fftx.cleanup();
   pressure_ffty.cleanup();
   vt_fftx.cleanup();
@@ -1666,6 +1680,8 @@ real4d qn              ;
 real2d qpsrc           ;
 real2d qpevp           ;
 intHost1d flag_precip      ;
+int1d micro_adv_inds       ;
+intHost1d micro_adv_inds_host;
 int3d flag_top         ;
 
 real4d u_esmt          ;
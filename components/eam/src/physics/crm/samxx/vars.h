@@ -373,6 +373,8 @@ extern real4d qn              ;
 extern real2d qpsrc           ;
 extern real2d qpevp           ;
 extern intHost1d flag_precip  ;
+extern int1d micro_adv_inds   ; // Indices of the advected micro_field entries
+extern intHost1d micro_adv_inds_host;
 extern int3d flag_top         ;
 
 extern real2d u_esmt_sgs      ;
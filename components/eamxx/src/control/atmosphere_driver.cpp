@@ -7,8 +7,10 @@
 #include "share/field/field_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_timing.hpp"
+#include "share/util/scream_tracing.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_io_worker.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -150,6 +152,14 @@ init_scorpio(const int atm_id)
   // not be, depending on what scorpio does.
   init_gptl(m_gptl_externally_handled);
 
+  // Optionally, record per-step timelines of all timers (see scream_tracing.hpp)
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  if (driver_options_pl.get<bool>("enable_tracing",false)) {
+    init_tracing(m_atm_comm,"scream_trace",
+                 driver_options_pl.get<int>("tracing_buffer_capacity",100000),
+                 driver_options_pl.get<bool>("tracing_kokkos_kernels",false));
+  }
+
   m_ad_status |= s_scorpio_inited;
 }
 
@@ -581,6 +591,9 @@ void AtmosphereDriver::initialize_output_managers () {
 
   auto& io_params = m_atm_params.sublist("Scorpio");
 
+  // Diagnostics requested by several output streams are created and computed only once
+  m_diag_registry = std::make_shared<DiagnosticRegistry>();
+
   // IMPORTANT: create model restart OutputManager first! This OM will be able to
   // retrieve the original simulation start date, which we later pass to the
   // OM of all the requested outputs.
@@ -591,6 +604,7 @@ void AtmosphereDriver::initialize_output_managers () {
     // Signal that this is not a normal output, but the model restart one
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
+    om.set_diagnostic_registry(m_diag_registry);
     if (fvphyshack) {
       // Don't save CGLL fields from ICs to the restart file.
       std::map<std::string,field_mgr_ptr> fms;
@@ -617,9 +631,16 @@ void AtmosphereDriver::initialize_output_managers () {
       params.set<std::string>("Casename",m_casename+".scream.h"+std::to_string(om_tally));
       om_tally++;
     }
+    // Async writes need MPI_THREAD_MULTIPLE. Without it, the output manager writes synchronously.
+    if (params.get("Async Write",false) && not scorpio::IOWorker::is_supported()) {
+      m_atm_logger->warn("[EAMxx] Async Write was requested in '" + fname + "', but MPI was not\n"
+                         "        initialized with MPI_THREAD_MULTIPLE. Falling back to synchronous writes.");
+      params.set("Async Write",false);
+    }
     // Add a new output manager
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
+    om.set_diagnostic_registry(m_diag_registry);
     om.setup(m_atm_comm,params,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,false);
   }
 
@@ -1224,6 +1245,7 @@ initialize (const ekat::Comm& atm_comm,
 }
 
 void AtmosphereDriver::run (const int dt) {
+  trace_new_step(m_current_ts.get_num_steps());
   start_timer("EAMxx::run");
 
   // Make sure the end of the time step is after the current start_time
@@ -1277,6 +1299,7 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     out_mgr.finalize();
   }
   m_output_managers.clear();
+  m_diag_registry = nullptr;
 
   // Finalize, and then destroy all atmosphere processes
   m_atm_process_group->finalize( /* inputs ? */ );
@@ -1297,6 +1320,9 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     it.second->clean_up();
   }
 
+  // Write the remaining trace events (if tracing is enabled)
+  finalize_tracing();
+
   // Write all timers to file, and possibly finalize gptl
   if (not m_gptl_externally_handled) {
     write_timers_to_file (m_atm_comm,"scream_timing.txt");
@@ -184,6 +184,7 @@ protected:
   ekat::ParameterList                       m_atm_params;
 
   std::list<OutputManager>                  m_output_managers;
+  std::shared_ptr<DiagnosticRegistry>       m_diag_registry;
 
   std::shared_ptr<ATMBufferManager>         m_memory_buffer;
   std::shared_ptr<SCDataManager>            m_surface_coupling_import_data_manager;
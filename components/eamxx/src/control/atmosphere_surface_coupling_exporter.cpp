@@ -43,7 +43,8 @@ void SurfaceCouplingExporter::set_grids(const std::shared_ptr<const GridsManager
   FieldLayout scalar3d_layout_mid { {COL,LEV},     {m_num_cols,    m_num_levs  } };
   FieldLayout scalar3d_layout_int { {COL,ILEV},    {m_num_cols,    m_num_levs+1} };
 
-  constexpr int ps = Spack::n;
+  // The state fields are viewed with the pack size of DerivedThermoState
+  constexpr int ps = DerivedThermoState::Pack::n;
 
   // These fields are required for computation/exports
   add_field<Required>("p_int",                scalar3d_layout_int,  Pa,    grid_name);
@@ -88,37 +89,6 @@ void SurfaceCouplingExporter::create_helper_field (const std::string& name,
   m_helper_fields[name] = f;
 }
 // =========================================================================================
-size_t SurfaceCouplingExporter::requested_buffer_size_in_bytes() const
-{
-  // Number of Reals needed by local views in the interface
-  return Buffer::num_2d_vector_mid*m_num_cols*ekat::npack<Spack>(m_num_levs)*sizeof(Spack) +
-         Buffer::num_2d_vector_int*m_num_cols*ekat::npack<Spack>(m_num_levs+1)*sizeof(Spack);
-}
-// =========================================================================================
-void SurfaceCouplingExporter::init_buffers(const ATMBufferManager &buffer_manager)
-{
-  const int nlev_packs       = ekat::npack<Spack>(m_num_levs);
-  const int nlevi_packs      = ekat::npack<Spack>(m_num_levs+1);
-
-  EKAT_REQUIRE_MSG(buffer_manager.allocated_bytes() >= requested_buffer_size_in_bytes(), "Error! Buffers size not sufficient.\n");
-
-  Real* mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
-
-  // 2d views packed views
-  Spack* s_mem = reinterpret_cast<Spack*>(mem);
-
-  m_buffer.dz = decltype(m_buffer.dz)(s_mem, m_num_cols, nlev_packs);
-  s_mem += m_buffer.dz.size();
-  m_buffer.z_mid = decltype(m_buffer.z_mid)(s_mem, m_num_cols, nlev_packs);
-  s_mem += m_buffer.z_mid.size();
-  m_buffer.z_int = decltype(m_buffer.z_int)(s_mem, m_num_cols, nlevi_packs);
-  s_mem += m_buffer.z_int.size();
-
-  size_t used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
-
-  EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for SurfaceCouplingExporter.");
-}
-// =========================================================================================
 void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &sc_data_manager)
 {
   m_num_cpl_exports    = sc_data_manager.get_num_cpl_fields();
@@ -131,7 +101,8 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
   // The export data is of size ncols,num_cpl_exports. All other data is of size num_scream_exports
   m_cpl_exports_view_h = decltype(m_cpl_exports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_exports);
-  m_cpl_exports_view_d = Kokkos::create_mirror_view(DefaultDevice(), m_cpl_exports_view_h);
+  m_cpl_exports_view_d = create_cpl_data_view(sc_data_manager.get_field_data_ptr(),
+                                              m_num_cols, m_num_cpl_exports);
 
   m_export_field_names = new name_t[m_num_scream_exports];
   std::memcpy(m_export_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_exports*32*sizeof(char));
@@ -198,6 +169,10 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   // Copy data to device for use in do_export()
   Kokkos::deep_copy(m_column_info_d, m_column_info_h);
 
+  // dz and z_mid are shared with other clients of the same atm state
+  m_derived_state = DerivedThermoState::get_instance(get_field_in("T_mid"),get_field_in("p_mid"),
+                                                     get_field_in("pseudo_density"),get_field_in("qv"));
+
   // Perform initial export (if any are marked for export during initialization)
   if (any_initial_exports) do_export(0, true);
 }
@@ -213,10 +188,9 @@ void SurfaceCouplingExporter::do_export(const double dt, const bool called_durin
   using PC = physics::Constants<Real>;
 
   const auto& p_int                = get_field_in("p_int").get_view<const Real**>();
-  const auto& pseudo_density       = get_field_in("pseudo_density").get_view<const Spack**>();
-  const auto& qv                   = get_field_in("qv").get_view<const Spack**>();
-  const auto& T_mid                = get_field_in("T_mid").get_view<const Spack**>();
-  const auto& p_mid                = get_field_in("p_mid").get_view<const Spack**>();
+  const auto& pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
+  const auto& T_mid                = get_field_in("T_mid").get_view<const Real**>();
+  const auto& p_mid                = get_field_in("p_mid").get_view<const Real**>();
   const auto& phis                 = get_field_in("phis").get_view<const Real*>();
 
   const auto& precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real*>();
@@ -229,13 +203,9 @@ void SurfaceCouplingExporter::do_export(const double dt, const bool called_durin
   const auto Faxa_rainl = m_helper_fields.at("Faxa_rainl").get_view<Real*>();
   const auto Faxa_snowl = m_helper_fields.at("Faxa_snowl").get_view<Real*>();
 
-  const auto dz    = m_buffer.dz;
-  const auto z_int = m_buffer.z_int;
-  const auto z_mid = m_buffer.z_mid;
-
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
+  // Vertical layer thickness and heights (relative to ground surface rather than from sea level)
+  const auto dz    = m_derived_state->get_dz().get_view<const Real**>();
+  const auto z_mid = m_derived_state->get_z_mid().get_view<const Real**>();
 
   // Local copies, to deal with CUDA's handling of *this.
   const int  num_levs           = m_num_levs;
@@ -243,45 +213,20 @@ void SurfaceCouplingExporter::do_export(const double dt, const bool called_durin
   const auto cpl_exports_view_d = m_cpl_exports_view_d;
   const int  num_cols           = m_num_cols;
   const int  num_exports        = m_num_scream_exports;
+  const int  num_cpl_exports    = m_num_cpl_exports;
 
-  // Preprocess exports
-  const auto setup_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(num_cols, num_levs);
-  Kokkos::parallel_for(setup_policy, KOKKOS_LAMBDA(const Kokkos::TeamPolicy<KT::ExeSpace>::member_type& team) {
-    const int i = team.league_rank();
-
-    const auto qv_i             = ekat::subview(qv, i);
-    const auto T_mid_i          = ekat::subview(T_mid, i);
-    const auto p_mid_i          = ekat::subview(p_mid, i);
-    const auto p_int_i          = ekat::subview(p_int, i);
-    const auto pseudo_density_i = ekat::subview(pseudo_density, i);
-    const auto dz_i             = ekat::subview(dz, i);
-    const auto z_int_i          = ekat::subview(z_int, i);
-    const auto z_mid_i          = ekat::subview(z_mid, i);
-
-    // Compute vertical layer thickness
-    PF::calculate_dz(team, pseudo_density_i, p_mid_i, T_mid_i, qv_i, dz_i);
-    team.team_barrier();
-
-    // Compute vertical layer heights (relative to ground surface rather than from sea level).
-    // Use z_int(nlevs) = z_surf = 0.0.
-    const Real z_surf = 0.0;
-    PF::calculate_z_int(team, num_levs, dz_i, z_surf, z_int_i);
-    team.team_barrier();
-    PF::calculate_z_mid(team, num_levs, z_int_i, z_mid_i);
-    team.team_barrier();
-
-    const auto s_dz_i = ekat::scalarize(dz_i);
-    const auto s_z_mid_i = ekat::scalarize(z_mid_i);
-    const auto s_pseudo_density_i = ekat::scalarize(pseudo_density_i);
-    const auto s_p_mid_i = ekat::scalarize(p_mid_i);
-    const auto s_T_mid_i = ekat::scalarize(T_mid_i);
+  // Preprocess and pack exports in a single kernel. Only the bottom level is needed,
+  // and each export only reads the surface value of its column, so we use one thread
+  // per column, which computes the helper fields and then packs its row of the cpl data.
+  Kokkos::parallel_for(policy_type(0,num_cols), KOKKOS_LAMBDA(const int& i) {
+    const int k = num_levs-1;
 
     // Calculate air temperature at bottom of cell closest to the ground for PSL
-    const Real T_int_bot = PF::calculate_surface_air_T(s_T_mid_i(num_levs-1),s_z_mid_i(num_levs-1));
-    Sa_z(i)    = s_z_mid_i(num_levs-1);
-    Sa_ptem(i) = PF::calculate_theta_from_T(s_T_mid_i(num_levs-1), s_p_mid_i(num_levs-1));
-    Sa_dens(i) = PF::calculate_density(s_pseudo_density_i(num_levs-1), s_dz_i(num_levs-1));
-    Sa_pslv(i) = PF::calculate_psl(T_int_bot, p_int_i(num_levs), phis(i));
+    const Real T_int_bot = PF::calculate_surface_air_T(T_mid(i,k),z_mid(i,k));
+    Sa_z(i)    = z_mid(i,k);
+    Sa_ptem(i) = PF::calculate_theta_from_T(T_mid(i,k), p_mid(i,k));
+    Sa_dens(i) = PF::calculate_density(pseudo_density(i,k), dz(i,k));
+    Sa_pslv(i) = PF::calculate_psl(T_int_bot, p_int(i,num_levs), phis(i));
 
     if (not called_during_initialization) {
       // Precipitation has units of kg/m2, and Faxa_rainl/snowl
@@ -290,25 +235,32 @@ void SurfaceCouplingExporter::do_export(const double dt, const bool called_durin
       Faxa_rainl(i) = precip_liq_surf_mass(i)/dt*(1000.0/PC::RHO_H2O);
       Faxa_snowl(i) = precip_ice_surf_mass(i)/dt*(1000.0/PC::RHO_H2O);
     }
-  });
 
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
-  Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
-
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
+    // Any field not exported by scream, or not exported
+    // during initialization, is set to 0.0
+    for (int j=0; j<num_cpl_exports; ++j) {
+      cpl_exports_view_d(i,j) = 0;
+    }
+
+    // Export to cpl data
+    for (int ifield=0; ifield<num_exports; ++ifield) {
+      const auto& info = col_info(ifield);
+      const auto offset = i*info.col_stride + info.col_offset;
+
+      // if this is during initialization, check whether or not the field should be exported
+      bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+      if (do_export) {
+        cpl_exports_view_d(i,info.cpl_indx) = info.constant_multiple*info.data[offset];
+      }
     }
   });
 
-  // Deep copy fields from device to cpl host array
-  Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  // Copy fields from device view to cpl host array (unless they alias the same memory)
+  if (m_cpl_exports_view_d.data()!=m_cpl_exports_view_h.data()) {
+    Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  } else {
+    Kokkos::fence();
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::finalize_impl()
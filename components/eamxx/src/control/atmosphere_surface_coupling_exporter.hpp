@@ -4,7 +4,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
-#include "share/atm_process/ATMBufferManager.hpp"
+#include "share/field/derived_thermo_state.hpp"
 #include "share/atm_process/SCDataManager.hpp"
 
 #include "surface_coupling_utils.hpp"
@@ -55,16 +55,6 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
-  // Structure for storing local variables initialized using the ATMBufferManager
-  struct Buffer {
-    static constexpr int num_2d_vector_mid = 2;
-    static constexpr int num_2d_vector_int = 1;
-
-    uview_2d<DefaultDevice, Spack> dz;
-    uview_2d<DefaultDevice, Spack> z_mid;
-    uview_2d<DefaultDevice, Spack> z_int;
-  };
-
   // Function which performes the export from scream fields,
   // If calling in initialize_impl(), set
   // called_during_initialization=true to avoid exporting fields
@@ -89,13 +79,6 @@ protected:
   // Query if a local field exists
   bool has_helper_field (const std::string& name) const { return m_helper_fields.find(name)!=m_helper_fields.end(); }
 
-  // Computes total number of bytes needed for local variables
-  size_t requested_buffer_size_in_bytes() const;
-
-  // Set local variables using memory provided by
-  // the ATMBufferManager
-  void init_buffers(const ATMBufferManager &buffer_manager);
-
   std::shared_ptr<const AbstractGrid> m_grid;
 
   // Keep track of field dimensions and the iteration count
@@ -105,8 +88,8 @@ protected:
   // Some helper fields.
   std::map<std::string,Field> m_helper_fields;
 
-  // Struct which contains local variables
-  Buffer m_buffer;
+  // Cache for dz and z_mid, shared with other clients of the atm state
+  std::shared_ptr<DerivedThermoState> m_derived_state;
 
   // Number of fields in cpl data
   Int m_num_cpl_exports;
@@ -116,8 +99,9 @@ protected:
 
   // Views storing a 2d array with dims (num_cols,num_fields) for cpl export data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
-  // pointer to the whole a2x array from Fortran)
-  view_2d <DefaultDevice, Real> m_cpl_exports_view_d;
+  // pointer to the whole a2x array from Fortran). If possible, the device view
+  // aliases the host one (see create_cpl_data_view).
+  SurfaceCouplingDataView       m_cpl_exports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_exports_view_h;
 
   // Array storing the field names for exports
@@ -68,8 +68,8 @@ void SurfaceCouplingImporter::set_grids(const std::shared_ptr<const GridsManager
   // The import data is of size ncols,num_cpl_imports. All other data is of size num_scream_imports
   m_cpl_imports_view_h = decltype(m_cpl_imports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_imports);
-  m_cpl_imports_view_d = Kokkos::create_mirror_view_and_copy(DefaultDevice(),
-                                                             m_cpl_imports_view_h);
+  m_cpl_imports_view_d = create_cpl_data_view(sc_data_manager.get_field_data_ptr(),
+                                              m_num_cols, m_num_cpl_imports);
   m_import_field_names = new name_t[m_num_scream_imports];
   std::memcpy(m_import_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_imports*32*sizeof(char));
 
@@ -147,8 +147,10 @@ void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
   const int  num_cols           = m_num_cols;
   const int  num_imports        = m_num_scream_imports;
 
-  // Deep copy cpl host array to devic
-  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  // Copy cpl host array to device view (unless they alias the same memory)
+  if (m_cpl_imports_view_d.data()!=m_cpl_imports_view_h.data()) {
+    Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  }
 
   // Unpack the fields
   auto unpack_policy = policy_type(0,num_imports*num_cols);
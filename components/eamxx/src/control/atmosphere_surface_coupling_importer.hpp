@@ -76,8 +76,9 @@ protected:
 
   // Views storing a 2d array with dims (num_cols,num_fields) for import data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
-  // pointer to the whole x2a array from Fortran)
-  view_2d <DefaultDevice, Real> m_cpl_imports_view_d;
+  // pointer to the whole x2a array from Fortran). If possible, the device view
+  // aliases the host one (see create_cpl_data_view).
+  SurfaceCouplingDataView       m_cpl_imports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_imports_view_h;
 
   // Array storing the field names for imports
@@ -2,6 +2,19 @@
 
 namespace scream {
 
+SurfaceCouplingDataView create_cpl_data_view (Real* cpl_data, const int num_cols, const int num_cpl_fields)
+{
+  using exec_space = DefaultDevice::execution_space;
+  constexpr bool host_accessible = Kokkos::SpaceAccessibility<exec_space,Kokkos::HostSpace>::accessible;
+
+  if (host_accessible) {
+    // Zero-copy: kernels can directly read/write the cpl data
+    return SurfaceCouplingDataView(cpl_data,num_cols,num_cpl_fields);
+  }
+  return SurfaceCouplingDataView(Kokkos::view_alloc(Kokkos::WithoutInitializing,"cpl_data"),
+                                 num_cols,num_cpl_fields);
+}
+
 void get_col_info_for_surface_values(const std::shared_ptr<const FieldHeader>& fh,
                                      int vecComp, int& col_offset, int& col_stride)
 {
@@ -12,6 +12,26 @@ enum class SurfaceCouplingTransferType {
   Export
 };
 
+// Memory space of the device copy of the cpl data (the cpl data itself is in host memory).
+// On GPU, we use host pinned memory, which kernels can access directly, so that packing and
+// unpacking kernels read/write the cpl buffer without a separate device copy, and we only
+// need a host-to-host copy to/from the cpl data. On CPU, the device copy aliases the cpl data.
+#if defined(KOKKOS_ENABLE_CUDA)
+using SurfaceCouplingDataSpace = Kokkos::CudaHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_HIP)
+using SurfaceCouplingDataSpace = Kokkos::Experimental::HIPHostPinnedSpace;
+#else
+using SurfaceCouplingDataSpace = DefaultDevice::memory_space;
+#endif
+
+// View of the cpl data, with dims (num_cols,num_cpl_fields). The field idx strides faster,
+// since that's what mct does (the attribute vectors are stored as rAttr(num_fields,num_cols)).
+using SurfaceCouplingDataView = Kokkos::View<Real**,Kokkos::LayoutRight,SurfaceCouplingDataSpace>;
+
+// Create the device copy of the cpl data. If the device can access the cpl data memory,
+// the returned view aliases it; otherwise, a host pinned view is allocated.
+SurfaceCouplingDataView create_cpl_data_view (Real* cpl_data, const int num_cols, const int num_cpl_fields);
+
 // A device-friendly helper struct, storing column information about the import/export.
 struct SurfaceCouplingColumnInfo {
   // Set to invalid, for ease of checking
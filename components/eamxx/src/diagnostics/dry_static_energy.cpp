@@ -43,55 +43,29 @@ void DryStaticEnergyDiagnostic::set_grids(const std::shared_ptr<const GridsManag
   auto& C_ap = m_diagnostic_output.get_header().get_alloc_properties();
   C_ap.request_allocation(ps);
   m_diagnostic_output.allocate_view();
-
-  // Initialize a 2d view of dz to be used in compute_diagnostic
-  const auto npacks     = ekat::npack<Pack>(m_num_levs);
-  const auto npacks_p1  = ekat::npack<Pack>(m_num_levs+1);
-  m_tmp_mid = view_2d("",m_num_cols,npacks);
-  m_tmp_int = view_2d("",m_num_cols,npacks_p1);
+}
+// =========================================================================================
+void DryStaticEnergyDiagnostic::initialize_impl(const RunType /* run_type */)
+{
+  m_derived_state = DerivedThermoState::get_instance(get_field_in("T_mid"),get_field_in("p_mid"),
+                                                     get_field_in("pseudo_density"),get_field_in("qv"));
 }
 // =========================================================================================
 void DryStaticEnergyDiagnostic::compute_diagnostic_impl()
 {
+  const auto npacks = ekat::npack<Pack>(m_num_levs);
 
-  const auto npacks     = ekat::npack<Pack>(m_num_levs);
-  const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(m_num_cols, npacks);
-
-  const auto& dse                = m_diagnostic_output.get_view<Pack**>();
-  const auto& T_mid              = get_field_in("T_mid").get_view<const Pack**>();
-  const auto& p_mid              = get_field_in("p_mid").get_view<const Pack**>();
-  const auto& qv_mid             = get_field_in("qv").get_view<const Pack**>();
-  const auto& pseudo_density_mid = get_field_in("pseudo_density").get_view<const Pack**>();
-  const auto& phis               = get_field_in("phis").get_view<const Real*>();
-
-  // Set surface geopotential for this diagnostic
-  const Real surf_geopotential = 0.0;
+  const auto& dse   = m_diagnostic_output.get_view<Pack**>();
+  const auto& T_mid = get_field_in("T_mid").get_view<const Pack**>();
+  const auto& phis  = get_field_in("phis").get_view<const Real*>();
+  const auto& z_mid = m_derived_state->get_z_mid().get_view<const Pack**>();
 
-  const int num_levs = m_num_levs;
-  auto      tmp_mid  = m_tmp_mid;
-  auto      tmp_int  = m_tmp_int;
-  Kokkos::deep_copy(tmp_mid,0.0);
-  Kokkos::deep_copy(tmp_int,0.0);
   Kokkos::parallel_for("DryStaticEnergyDiagnostic",
-                       default_policy,
-                       KOKKOS_LAMBDA(const MemberType& team) {
-    const int icol = team.league_rank();
-    const auto& dz_s    = ekat::subview(tmp_mid,icol);
-    const auto& z_int_s = ekat::subview(tmp_int,icol);
-    const auto& z_mid_s = dz_s; // Reuse the memory for z_mid, but set a new variable for code readability.
-    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npacks), [&] (const Int& jpack) {
-      dz_s(jpack) = PF::calculate_dz(pseudo_density_mid(icol,jpack), p_mid(icol,jpack), T_mid(icol,jpack), qv_mid(icol,jpack));
-    });
-    team.team_barrier();
-    PF::calculate_z_int(team,num_levs,dz_s,surf_geopotential,z_int_s);
-    team.team_barrier();
-    PF::calculate_z_mid(team,num_levs,z_int_s,z_mid_s);
-    team.team_barrier();
-    const auto& dse_s = ekat::subview(dse,icol);
-    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npacks), [&] (const Int& jpack) {
-      dse_s(jpack) = PF::calculate_dse(T_mid(icol,jpack),z_mid_s(jpack),phis(icol));
-    });
-    team.team_barrier();
+                       Kokkos::RangePolicy<>(0,m_num_cols*npacks),
+                       KOKKOS_LAMBDA(const int& idx) {
+      const int icol  = idx / npacks;
+      const int jpack = idx % npacks;
+      dse(icol,jpack) = PF::calculate_dse(T_mid(icol,jpack),z_mid(icol,jpack),phis(icol));
   });
   Kokkos::fence();
 
@@ -3,6 +3,7 @@
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
+#include "share/field/derived_thermo_state.hpp"
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
 namespace scream
@@ -41,12 +42,14 @@ public:
   void compute_diagnostic_impl ();
 protected:
 
+  void initialize_impl (const RunType run_type);
+
   // Keep track of field dimensions
   Int m_num_cols;
   Int m_num_levs;
 
-  // Temporary view to set dz in compute diagnostic
-  view_2d m_dz;
+  // The derived quantities of the state are computed (and cached) here
+  std::shared_ptr<DerivedThermoState> m_derived_state;
 
 }; // class VerticalLayerInterfaceDiagnostic
 
@@ -41,42 +41,17 @@ set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   auto& C_ap = m_diagnostic_output.get_header().get_alloc_properties();
   C_ap.request_allocation(ps);
   m_diagnostic_output.allocate_view();
-
-  // Initialize 2d view of dz to be used in compute_diagnostic
-  const auto npacks_p1  = ekat::npack<Pack>(m_num_levs+1);
-  m_z_int = view_2d("",m_num_cols,npacks_p1);
+}
+// =========================================================================================
+void VerticalLayerMidpointDiagnostic::initialize_impl(const RunType /* run_type */)
+{
+  m_derived_state = DerivedThermoState::get_instance(get_field_in("T_mid"),get_field_in("p_mid"),
+                                                     get_field_in("pseudo_density"),get_field_in("qv"));
 }
 // =========================================================================================
 void VerticalLayerMidpointDiagnostic::compute_diagnostic_impl()
 {
-
-  const auto npacks     = ekat::npack<Pack>(m_num_levs);
-  const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(m_num_cols, npacks);
-  const auto& z_mid              = m_diagnostic_output.get_view<Pack**>();
-  const auto& T_mid              = get_field_in("T_mid").get_view<const Pack**>();
-  const auto& p_mid              = get_field_in("p_mid").get_view<const Pack**>();
-  const auto& qv_mid             = get_field_in("qv").get_view<const Pack**>();
-  const auto& pseudo_density_mid = get_field_in("pseudo_density").get_view<const Pack**>();
-
-  // Set surface geopotential for this diagnostic
-  const Real surf_geopotential = 0.0;
-
-  const int num_levs = m_num_levs;
-  auto z_int = m_z_int;
-  Kokkos::parallel_for("VerticalLayerMidpointDiagnostic",
-                       default_policy,
-                       KOKKOS_LAMBDA(const MemberType& team) {
-    const int icol = team.league_rank();
-    const auto& z_mid_s = ekat::subview(z_mid, icol);
-    const auto& dz_s    = z_mid_s; // Use the memory in z_mid for dz, since we don't set z_mid until after dz is no longer needed.
-    const auto& z_int_s = ekat::subview(z_int, icol);
-    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npacks), [&] (const Int& jpack) {
-      dz_s(jpack) = PF::calculate_dz(pseudo_density_mid(icol,jpack), p_mid(icol,jpack), T_mid(icol,jpack), qv_mid(icol,jpack));
-    });
-    team.team_barrier();
-    PF::calculate_z_int(team,num_levs,dz_s,surf_geopotential,z_int_s);
-    PF::calculate_z_mid(team,num_levs,z_int_s,z_mid_s);
-  });
+  m_diagnostic_output.deep_copy(m_derived_state->get_z_mid());
 
   const auto ts = get_field_in("qv").get_header().get_tracking().get_time_stamp();
   m_diagnostic_output.get_header().get_tracking().update_time_stamp(ts);
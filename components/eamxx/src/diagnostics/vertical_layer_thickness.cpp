@@ -41,25 +41,15 @@ void VerticalLayerThicknessDiagnostic::set_grids(const std::shared_ptr<const Gri
   m_diagnostic_output.allocate_view();
 }
 // =========================================================================================
+void VerticalLayerThicknessDiagnostic::initialize_impl(const RunType /* run_type */)
+{
+  m_derived_state = DerivedThermoState::get_instance(get_field_in("T_mid"),get_field_in("p_mid"),
+                                                     get_field_in("pseudo_density"),get_field_in("qv"));
+}
+// =========================================================================================
 void VerticalLayerThicknessDiagnostic::compute_diagnostic_impl()
 {
-
-  const auto npacks  = ekat::npack<Pack>(m_num_levs);
-  const auto& dz                 = m_diagnostic_output.get_view<Pack**>();
-  const auto& T_mid              = get_field_in("T_mid").get_view<const Pack**>();
-  const auto& p_mid              = get_field_in("p_mid").get_view<const Pack**>();
-  const auto& qv_mid             = get_field_in("qv").get_view<const Pack**>();
-  const auto& pseudo_density_mid = get_field_in("pseudo_density").get_view<const Pack**>();
-
-
-  Kokkos::parallel_for("VerticalLayerThicknessDiagnostic",
-                       Kokkos::RangePolicy<>(0,m_num_cols*npacks),
-                       KOKKOS_LAMBDA(const int& idx) {
-      const int icol  = idx / npacks;
-      const int jpack = idx % npacks;
-      dz(icol,jpack) = PF::calculate_dz(pseudo_density_mid(icol,jpack), p_mid(icol,jpack), T_mid(icol,jpack), qv_mid(icol,jpack));
-  });
-  Kokkos::fence();
+  m_diagnostic_output.deep_copy(m_derived_state->get_dz());
 
   const auto ts = get_field_in("qv").get_header().get_tracking().get_time_stamp();
   m_diagnostic_output.get_header().get_tracking().update_time_stamp(ts);
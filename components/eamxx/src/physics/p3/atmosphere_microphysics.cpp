@@ -47,6 +47,7 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   infrastructure.kte = m_num_levs-1;
   infrastructure.predictNc = m_params.get<bool>("do_predict_nc",true); 
   infrastructure.prescribedCCN = m_params.get<bool>("do_prescribed_ccn",true); 
+  infrastructure.compact_active_columns = m_params.get<bool>("compact_active_columns",false);
 
   // Define the different field layouts that will be used for this process
   using namespace ShortFieldTagsNames;
@@ -129,11 +130,15 @@ size_t P3Microphysics::requested_buffer_size_in_bytes() const
       // 2d view scalar, size (ncol, 3)
       m_num_cols*3*sizeof(Real);
 
+  // State snapshot used by p3_main when compacting active columns
+  const size_t snapshot_request = infrastructure.compact_active_columns ?
+      P3F::P3Infrastructure::num_snapshot_vars*m_num_cols*nk_pack*sizeof(Spack) : 0;
+
   // Number of Reals needed by the WorkspaceManager passed to p3_main
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
   const size_t wsm_request   = WSM::get_total_bytes_needed(nk_pack_p1, 52, policy);
 
-  return interface_request + wsm_request;
+  return interface_request + snapshot_request + wsm_request;
 }
 
 // =========================================================================================
@@ -182,6 +187,12 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
   m_buffer.unused = decltype(m_buffer.unused)(s_mem, m_num_cols, nk_pack);
   s_mem += m_buffer.unused.size();
 
+  // 3d packed views
+  if (infrastructure.compact_active_columns) {
+    m_buffer.state_snapshot = decltype(m_buffer.state_snapshot)(s_mem, P3F::P3Infrastructure::num_snapshot_vars, m_num_cols, nk_pack);
+    s_mem += m_buffer.state_snapshot.size();
+  }
+
   // WSM data
   m_buffer.wsm_data = s_mem;
 
@@ -217,9 +228,11 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qc"),m_grid,0.0,1.0e2,false);
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qi"),m_grid,0.0,5.0e3,false);
 
-  // Initialize p3
+  // Initialize p3. The ice lookup table is read (on the root rank only)
+  // and broadcast by init_kokkos_ice_lookup_tables, so skip the Fortran one.
   p3::p3_init(/* write_tables = */ false,
-              this->get_comm().am_i_root());
+              this->get_comm().am_i_root(),
+              /* read_ice_table = */ false);
 
   // Initialize all of the structures that are passed to p3_main in run_impl.
   // Note: Some variables in the structures are not stored in the field manager.  For these
@@ -296,6 +309,7 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   diag_outputs.precip_liq_flux  = m_buffer.precip_liq_flux;
   diag_outputs.precip_ice_flux  = m_buffer.precip_ice_flux;
   // -- Infrastructure, what is left to assign
+  infrastructure.state_snapshot = m_buffer.state_snapshot;
   infrastructure.col_location = m_buffer.col_location; // TODO: Initialize this here and now when P3 has access to lat/lon for each column.
   // --History Only
   history_only.liq_ice_exchange = get_field_out("micro_liq_ice_exchange").get_view<Pack**>();
@@ -318,8 +332,8 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
     p3_postproc.set_mass_and_energy_fluxes(vapor_flux, water_flux, ice_flux, heat_flux);
   }
 
-  // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  // Load tables. Only the root rank reads the ice table file, the values are broadcast to the others.
+  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, get_comm());
   P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
                           lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
                           lookup_tables.dnu_table_vals);
@@ -35,9 +35,11 @@ class P3Microphysics : public AtmosphereProcess
   using view_2d  = typename P3F::view_2d<Spack>;
   using view_2d_const  = typename P3F::view_2d<const Spack>;
   using sview_2d = typename KokkosTypes<DefaultDevice>::template view_2d<Real>;
+  using view_3d  = typename P3F::view_3d<Spack>;
 
   using uview_1d  = Unmanaged<view_1d>;
   using uview_2d  = Unmanaged<view_2d>;
+  using uview_3d  = Unmanaged<view_3d>;
   using suview_2d = Unmanaged<sview_2d>;
 
 public:
@@ -365,6 +367,9 @@ public:
 
     suview_2d col_location;
 
+    // Only allocated if P3 compacts the active columns
+    uview_3d state_snapshot;
+
     Spack* wsm_data;
   };
 
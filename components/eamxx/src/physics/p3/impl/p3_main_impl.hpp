@@ -101,16 +101,62 @@ Int Functions<S,D>
   // per-column bools
   view_2d<bool> bools("bools", nj, 2);
 
+  // If active-column compaction is requested, p3_main runs in two passes:
+  //  - pass 0: all columns save their prognostic state, then run
+  //            p3_main_init and p3_main_part1 to find out if they are active.
+  //            Inactive columns are done after this pass.
+  //  - pass 1: only the active columns (listed in active_cols) run. They restore
+  //            their prognostic state and redo init/part1, so that the result is
+  //            bit-for-bit identical to the non-compacted run, then do the rest.
+  const bool compact = infrastructure.compact_active_columns;
+  const Int npasses  = compact ? 2 : 1;
+  view_1d<Int> active_cols;
+  const auto state_snapshot = infrastructure.state_snapshot;
+  if (compact) {
+    EKAT_REQUIRE_MSG (state_snapshot.extent_int(0)==P3Infrastructure::num_snapshot_vars &&
+                      state_snapshot.extent_int(1)>=nj && state_snapshot.extent_int(2)>=nk_pack,
+        "Error! P3Infrastructure::state_snapshot must be allocated when compact_active_columns=true.\n");
+    active_cols = view_1d<Int>("active_cols", nj);
+  }
+  Int nactive = nj;
+
   // we do not want to measure init stuff
   auto start = std::chrono::steady_clock::now();
 
+  for (Int pass = 0; pass < npasses; ++pass) {
+
+  const bool save_state    = compact && pass == 0;
+  const bool restore_state = compact && pass == 1;
+
+  if (restore_state) {
+    // Build the compacted list of active columns
+    Kokkos::parallel_scan(
+      "p3 active columns",
+      Kokkos::RangePolicy<ExeSpace>(0, nj),
+      KOKKOS_LAMBDA(const Int i, Int& count, const bool final) {
+      if (bools(i, 0) || bools(i, 1)) {
+        if (final) {
+          active_cols(count) = i;
+        }
+        ++count;
+      }
+    }, nactive);
+
+    if (nactive == 0) {
+      break;
+    }
+  }
+
+  const auto pass_policy = restore_state ?
+    ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nactive, nk_pack) : policy;
+
   // p3_main loop
   Kokkos::parallel_for(
     "p3 main loop",
-    policy,
+    pass_policy,
     KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = restore_state ? active_cols(team.league_rank()) : team.league_rank();
 
     auto workspace = workspace_mgr.get_workspace(team);
 
@@ -201,6 +247,36 @@ Int Functions<S,D>
     const auto oqv_prev            = ekat::subview(diagnostic_inputs.qv_prev, i);
     const auto ot_prev             = ekat::subview(diagnostic_inputs.t_prev, i);
 
+    if (save_state || restore_state) {
+      Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
+        if (save_state) {
+          state_snapshot(0, i, k) = oqv(k);
+          state_snapshot(1, i, k) = oth(k);
+          state_snapshot(2, i, k) = oqc(k);
+          state_snapshot(3, i, k) = onc(k);
+          state_snapshot(4, i, k) = oqr(k);
+          state_snapshot(5, i, k) = onr(k);
+          state_snapshot(6, i, k) = oqi(k);
+          state_snapshot(7, i, k) = oni(k);
+          state_snapshot(8, i, k) = oqm(k);
+          state_snapshot(9, i, k) = obm(k);
+        } else {
+          oqv(k) = state_snapshot(0, i, k);
+          oth(k) = state_snapshot(1, i, k);
+          oqc(k) = state_snapshot(2, i, k);
+          onc(k) = state_snapshot(3, i, k);
+          oqr(k) = state_snapshot(4, i, k);
+          onr(k) = state_snapshot(5, i, k);
+          oqi(k) = state_snapshot(6, i, k);
+          oni(k) = state_snapshot(7, i, k);
+          oqm(k) = state_snapshot(8, i, k);
+          obm(k) = state_snapshot(9, i, k);
+        }
+      });
+      team.team_barrier();
+    }
+
     // Need to watch out for race conditions with these shared variables
     bool &nucleationPossible  = bools(i, 0);
     bool &hydrometeorsPresent = bools(i, 1);
@@ -231,8 +307,9 @@ Int Functions<S,D>
       obm, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld, nr_incld,
       ni_incld, bm_incld, nucleationPossible, hydrometeorsPresent);
 
-    // There might not be any work to do for this team
-    if (!(nucleationPossible || hydrometeorsPresent)) {
+    // There might not be any work to do for this team. When compacting, the
+    // first pass only needs to know which columns are active.
+    if (save_state || !(nucleationPossible || hydrometeorsPresent)) {
       return; // this is how you do a "continue" in a kokkos lambda
     }
 
@@ -320,6 +397,8 @@ Int Functions<S,D>
                  team, ocol_location);
 #endif
   });
+
+  } // passes
   Kokkos::fence();
 
   auto finish = std::chrono::steady_clock::now();
@@ -16,6 +16,13 @@ namespace p3 {
 template <typename S, typename D>
 void Functions<S,D>
 ::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+  init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals, ekat::Comm(MPI_COMM_SELF));
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+                                const ekat::Comm& comm) {
 
   using DeviceIcetable = typename view_ice_table::non_const_type;
   using DeviceColtable = typename view_collect_table::non_const_type;
@@ -27,49 +34,83 @@ void Functions<S,D>
   const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
 
   //
-  // read in ice microphysics table into host views
+  // read in ice microphysics table into host views (root rank only)
   //
 
-  std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
-
-  std::ifstream in(filename);
-
-  // read header
-  std::string version, version_val;
-  in >> version >> version_val;
-  EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
-  EKAT_REQUIRE_MSG(version_val == P3C::p3_version, "Bad " << filename << ", expected version " << P3C::p3_version << ", but got " << version_val);
-
-  // read tables
-  double dum_s; int dum_i; // dum_s needs to be double to stream correctly
-  for (int jj = 0; jj < P3C::densize; ++jj) {
-    for (int ii = 0; ii < P3C::rimsize; ++ii) {
-      for (int i = 0; i < P3C::isize; ++i) {
-        in >> dum_i >> dum_i;
-        int j_idx = 0;
-        for (int j = 0; j < 15; ++j) {
-          in >> dum_s;
-          if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
-          }
-        }
+  // NOTE: errors are not thrown on root right away, since the other ranks
+  //       would hang in the broadcast. Instead, root stores the error message,
+  //       and broadcasts a status flag, so that all ranks fail together.
+  const std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+  std::string err_msg;
+  if (comm.am_i_root()) {
+    std::ifstream in(filename);
+    if (!in.good()) {
+      err_msg = "Could not open P3 lookup table file " + filename;
+    }
+
+    // read header
+    std::string version, version_val;
+    if (err_msg.empty()) {
+      in >> version >> version_val;
+      if (version != "VERSION") {
+        err_msg = "Bad " + filename + ", expected VERSION X.Y.Z header";
+      } else if (version_val != P3C::p3_version) {
+        err_msg = "Bad " + filename + ", expected version " + P3C::p3_version + ", but got " + version_val;
       }
+    }
+
+    // read tables
+    if (err_msg.empty()) {
+      double dum_s; int dum_i; // dum_s needs to be double to stream correctly
+      for (int jj = 0; jj < P3C::densize; ++jj) {
+        for (int ii = 0; ii < P3C::rimsize; ++ii) {
+          for (int i = 0; i < P3C::isize; ++i) {
+            in >> dum_i >> dum_i;
+            int j_idx = 0;
+            for (int j = 0; j < 15; ++j) {
+              in >> dum_s;
+              if (j > 1 && j != 10) {
+                ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+              }
+            }
+          }
 
-      for (int i = 0; i < P3C::isize; ++i) {
-        for (int j = 0; j < P3C::rcollsize; ++j) {
-          in >> dum_i >> dum_i;
-          int k_idx = 0;
-          for (int k = 0; k < 6; ++k) {
-            in >> dum_s;
-            if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+          for (int i = 0; i < P3C::isize; ++i) {
+            for (int j = 0; j < P3C::rcollsize; ++j) {
+              in >> dum_i >> dum_i;
+              int k_idx = 0;
+              for (int k = 0; k < 6; ++k) {
+                in >> dum_s;
+                if (k == 3 || k == 4) {
+                  collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+                }
+              }
             }
           }
         }
       }
+      if (in.fail()) {
+        err_msg = "Error while parsing P3 lookup table file " + filename;
+      }
     }
   }
 
+  // Share the outcome of the read with all other ranks
+  int read_ok = err_msg.empty() ? 1 : 0;
+  if (comm.size()>1) {
+    comm.broadcast(&read_ok, 1, comm.root_rank());
+  }
+  EKAT_REQUIRE_MSG (read_ok==1,
+      "Error! Could not read the P3 ice lookup table on root rank.\n" +
+      (comm.am_i_root() ? err_msg : std::string("See root rank output for details.")) + "\n");
+
+  // Share the parsed values with all other ranks. The values are broadcast
+  // as-is, so every rank ends up with bit-for-bit the same tables.
+  if (comm.size()>1) {
+    comm.broadcast(ice_table_vals_h.data(), ice_table_vals_h.size(), comm.root_rank());
+    comm.broadcast(collect_table_vals_h.data(), collect_table_vals_h.size(), comm.root_rank());
+  }
+
   // deep copy to device
   Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
   Kokkos::deep_copy(collect_table_vals_d, collect_table_vals_h);
@@ -10,7 +10,8 @@ extern "C" {
   void micro_p3_utils_init_c(Real Cpair, Real Rair, Real RH2O, Real RHO_H2O,
                  Real MWH2O, Real MWdry, Real gravit, Real LatVap, Real LatIce,
                  Real CpLiq, Real Tmelt, Real Pi, bool masterproc);
-  void p3_init_c(const char** lookup_file_dir, int* info, const bool& write_tables);
+  void p3_init_c(const char** lookup_file_dir, int* info, const bool& write_tables,
+                 const bool& read_ice_table);
 }
 
 namespace scream {
@@ -99,15 +100,18 @@ void micro_p3_utils_init (const bool masterproc) {
                  c::CpLiq, c::Tmelt, c::Pi, masterproc);
 }
 
-void p3_init (const bool write_tables, const bool masterproc) {
+void p3_init (const bool write_tables, const bool masterproc, const bool read_ice_table) {
   static bool is_init = false;
-  if (!is_init) {
+  static bool ice_table_is_init = false;
+  // If a previous call skipped the ice table, but this one needs it, init again
+  if (!is_init || (read_ice_table && !ice_table_is_init)) {
     micro_p3_utils_init(masterproc);
     static const char* dir = SCREAM_DATA_DIR "/tables";
     Int info;
-    p3_init_c(&dir, &info, write_tables);
+    p3_init_c(&dir, &info, write_tables, read_ice_table);
     EKAT_REQUIRE_MSG(info == 0, "p3_init_c returned info " << info);
     is_init = true;
+    ice_table_is_init = ice_table_is_init || read_ice_table;
   }
 }
 
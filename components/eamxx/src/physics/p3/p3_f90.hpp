@@ -61,8 +61,11 @@ private:
   void init(const FortranData::Ptr& d);
 };
 
+// If read_ice_table=false, the Fortran ice lookup table is not read. This is
+// fine as long as only the C++ p3_main is used (see init_kokkos_ice_lookup_tables).
 void p3_init(const bool write_tables = false,
-             const bool masterproc = false);
+             const bool masterproc = false,
+             const bool read_ice_table = true);
 
 // We will likely want to remove these checks in the future, as we're not tied
 // to the exact implementation or arithmetic in P3. For now, these checks are
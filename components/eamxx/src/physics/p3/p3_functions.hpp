@@ -7,6 +7,7 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
 
 namespace scream {
 namespace p3 {
@@ -77,6 +78,8 @@ struct Functions
   using view_1d = typename KT::template view_1d<S>;
   template <typename S>
   using view_2d = typename KT::template view_2d<S>;
+  template <typename S>
+  using view_3d = typename KT::template view_3d<S>;
 
   // lookup table values for rain shape parameter mu_r
   using view_1d_table = typename KT::template view_1d_table<Scalar, C::MU_R_TABLE_DIM>;
@@ -205,6 +208,14 @@ struct Functions
     bool prescribedCCN;
     // Coordinates of columns, nj x 3
     view_2d<const Scalar> col_location;
+    // Set to true to run the bulk of p3_main only over the columns that have
+    // microphysics work to do (nucleation possible or hydrometeors present).
+    bool compact_active_columns = false;
+    // Storage for the prognostic state of each column between the two passes
+    // of p3_main, needed only if compact_active_columns=true.
+    // Size: num_snapshot_vars x nj x nk_pack
+    static constexpr int num_snapshot_vars = 10;
+    view_3d<Spack> state_snapshot;
   };
 
   // This struct stores tendencies computed by P3 and used by other
@@ -262,6 +273,12 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but only the root rank of comm reads the table file;
+  // the parsed values are then broadcast to all the other ranks.
+  static void init_kokkos_ice_lookup_tables(
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+    const ekat::Comm& comm);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -40,7 +40,7 @@ contains
 
   end subroutine init_tables_from_f90_c
 
-  subroutine p3_init_c(lookup_file_dir_c, info, write_tables) bind(c)
+  subroutine p3_init_c(lookup_file_dir_c, info, write_tables, read_ice_table) bind(c)
     use ekat_array_io_mod, only: array_io_file_exists
 #ifdef SCREAM_DOUBLE_PRECISION
     use ekat_array_io_mod, only: array_io_read=>array_io_read_double, array_io_write=>array_io_write_double
@@ -52,6 +52,7 @@ contains
     type(c_ptr), intent(in) :: lookup_file_dir_c
     integer(kind=c_int), intent(out) :: info
     logical(kind=c_bool), intent(in) :: write_tables
+    logical(kind=c_bool), intent(in) :: read_ice_table
 
     real(kind=c_real), dimension(150), target :: mu_r_table_vals
     real(kind=c_real), dimension(300,10), target :: vn_table_vals, vm_table_vals, revap_table_vals
@@ -62,9 +63,13 @@ contains
     logical :: ok
     character(len=16) :: p3_version="4.1.1"  ! TODO: Change to be dependent on table version and path specified in p3_functions.hpp
 
-    call c_f_pointer(lookup_file_dir_c, lookup_file_dir)
-    len = index(lookup_file_dir, C_NULL_CHAR) - 1
-    call p3_init_a(lookup_file_dir(1:len),p3_version)
+    ! The ice lookup table is only needed by the Fortran p3_main. Callers that
+    ! only run the C++ p3_main load it in C++, and can skip reading it here.
+    if (read_ice_table) then
+       call c_f_pointer(lookup_file_dir_c, lookup_file_dir)
+       len = index(lookup_file_dir, C_NULL_CHAR) - 1
+       call p3_init_a(lookup_file_dir(1:len),p3_version)
+    end if
 
     info = 0
     ok = .false.
@@ -59,6 +59,22 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
         }
       }
     }
+
+    // Tables read by the root rank and broadcast must match the ones read locally
+    view_ice_table ice_table_vals_bcast;
+    view_collect_table collect_table_vals_bcast;
+    Functions::init_kokkos_ice_lookup_tables(ice_table_vals_bcast, collect_table_vals_bcast,
+                                             ekat::Comm(MPI_COMM_WORLD));
+    const auto ice_table_vals_bcast_host = Kokkos::create_mirror_view(ice_table_vals_bcast);
+    const auto collect_table_vals_bcast_host = Kokkos::create_mirror_view(collect_table_vals_bcast);
+    Kokkos::deep_copy(ice_table_vals_bcast_host, ice_table_vals_bcast);
+    Kokkos::deep_copy(collect_table_vals_bcast_host, collect_table_vals_bcast);
+    for (size_t i = 0; i < ice_table_vals_host.size(); ++i) {
+      REQUIRE(ice_table_vals_bcast_host.data()[i] == ice_table_vals_host.data()[i]);
+    }
+    for (size_t i = 0; i < collect_table_vals_host.size(); ++i) {
+      REQUIRE(collect_table_vals_bcast_host.data()[i] == collect_table_vals_host.data()[i]);
+    }
   }
 
   template <typename View>
@@ -444,12 +444,102 @@ static void run_bfb_p3_main()
   }
 }
 
+static void run_compact_p3_main()
+{
+  // Compacting the active columns must not change the answers: run the C++
+  // p3_main with and without compaction on the same inputs, and compare.
+  auto engine = setup_random_test();
+
+  //              its, ite, kts, kte,   it,        dt, do_predict_nc, do_prescribed_CCN
+  P3MainData full(1,   10,   1,  72,    1, 1.800E+03, true,  false);
+
+  full.randomize(engine, {
+      {full.pres           , {1.00000000E+02 , 9.87111111E+04}},
+      {full.dz             , {1.22776609E+02 , 3.49039167E+04}},
+      {full.nc_nuceat_tend , {0              , 0}},
+      {full.nccn_prescribed, {0              , 0}},
+      {full.ni_activated   , {0              , 0}},
+      {full.dpres          , {1.37888889E+03, 1.39888889E+03}},
+      {full.inv_exner      , {1.00371345E+00, 3.19721007E+00}},
+      {full.cld_frac_i     , {1              , 1}},
+      {full.cld_frac_l     , {1              , 1}},
+      {full.cld_frac_r     , {1              , 1}},
+      {full.inv_qc_relvar  , {1              , 1}},
+      {full.qc             , {0              , 1.00000000E-04}},
+      {full.nc             , {1.00000000E+06 , 1.00000000E+06}},
+      {full.qr             , {0              , 1.00000000E-05}},
+      {full.nr             , {1.00000000E+06 , 1.00000000E+06}},
+      {full.qi             , {0              , 1.00000000E-04}},
+      {full.qm             , {0              , 1.00000000E-04}},
+      {full.ni             , {1.00000000E+06 , 1.00000000E+06}},
+      {full.bm             , {0              , 1.00000000E-02}},
+      {full.qv             , {0              , 5.00000000E-02}},
+      {full.qv_prev        , {0              , 5.00000000E-02}},
+      {full.th_atm         , {6.72653866E+02 , 1.07954335E+03}},
+      {full.t_prev         , {1.50000000E+02 , 3.50000000E+02}},
+  });
+
+  // Make every other column dry, so that it has no microphysics to do,
+  // and the compacted run actually skips some columns.
+  const Int nj = full.ite - full.its + 1;
+  const Int nk = full.kte - full.kts + 1;
+  for (Int i = 0; i < nj; i += 2) {
+    for (Int k = 0; k < nk; ++k) {
+      const Int t = i*nk + k;
+      full.qc[t] = full.qr[t] = full.qi[t] = full.qm[t] = full.qv[t] = 0;
+    }
+  }
+
+  P3MainData compact(full);
+
+  for (auto* d : {&full, &compact}) {
+    d->transpose<ekat::TransposeDirection::c2f>();
+    p3_main_f(
+      d->qc, d->nc, d->qr, d->nr, d->th_atm, d->qv, d->dt, d->qi, d->qm, d->ni,
+      d->bm, d->pres, d->dz, d->nc_nuceat_tend, d->nccn_prescribed, d->ni_activated, d->inv_qc_relvar, d->it, d->precip_liq_surf,
+      d->precip_ice_surf, d->its, d->ite, d->kts, d->kte, d->diag_eff_radius_qc, d->diag_eff_radius_qi,
+      d->rho_qi, d->do_predict_nc, d->do_prescribed_CCN, d->dpres, d->inv_exner, d->qv2qi_depos_tend,
+      d->precip_liq_flux, d->precip_ice_flux, d->cld_frac_r, d->cld_frac_l, d->cld_frac_i,
+      d->liq_ice_exchange, d->vap_liq_exchange, d->vap_ice_exchange, d->qv_prev, d->t_prev,
+      /* compact_active_columns = */ d==&compact);
+    d->transpose<ekat::TransposeDirection::f2c>();
+  }
+
+  const auto tot = full.total(full.qc);
+  for (Int t = 0; t < tot; ++t) {
+    REQUIRE(full.qc[t]                 == compact.qc[t]);
+    REQUIRE(full.nc[t]                 == compact.nc[t]);
+    REQUIRE(full.qr[t]                 == compact.qr[t]);
+    REQUIRE(full.nr[t]                 == compact.nr[t]);
+    REQUIRE(full.qi[t]                 == compact.qi[t]);
+    REQUIRE(full.qm[t]                 == compact.qm[t]);
+    REQUIRE(full.ni[t]                 == compact.ni[t]);
+    REQUIRE(full.bm[t]                 == compact.bm[t]);
+    REQUIRE(full.qv[t]                 == compact.qv[t]);
+    REQUIRE(full.th_atm[t]             == compact.th_atm[t]);
+    REQUIRE(full.diag_eff_radius_qc[t] == compact.diag_eff_radius_qc[t]);
+    REQUIRE(full.diag_eff_radius_qi[t] == compact.diag_eff_radius_qi[t]);
+    REQUIRE(full.rho_qi[t]             == compact.rho_qi[t]);
+    REQUIRE(full.qv2qi_depos_tend[t]   == compact.qv2qi_depos_tend[t]);
+    REQUIRE(full.liq_ice_exchange[t]   == compact.liq_ice_exchange[t]);
+    REQUIRE(full.vap_liq_exchange[t]   == compact.vap_liq_exchange[t]);
+    REQUIRE(full.vap_ice_exchange[t]   == compact.vap_ice_exchange[t]);
+    REQUIRE(full.precip_liq_flux[t]    == compact.precip_liq_flux[t]);
+    REQUIRE(full.precip_ice_flux[t]    == compact.precip_ice_flux[t]);
+  }
+  for (Int i = 0; i < nj; ++i) {
+    REQUIRE(full.precip_liq_surf[i] == compact.precip_liq_surf[i]);
+    REQUIRE(full.precip_ice_surf[i] == compact.precip_ice_surf[i]);
+  }
+}
+
 static void run_bfb()
 {
   run_bfb_p3_main_part1();
   run_bfb_p3_main_part2();
   run_bfb_p3_main_part3();
   run_bfb_p3_main();
+  run_compact_p3_main();
 }
 
 };
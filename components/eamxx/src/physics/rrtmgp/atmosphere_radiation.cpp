@@ -82,10 +82,12 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   FieldLayout scalar3d_lwgpts_layout { {COL,LWGPT,LEV}, {m_ncol, m_nlwgpts, m_nlay} };
 
   constexpr int ps = SCREAM_SMALL_PACK_SIZE;
+  // The state fields are viewed with the pack size of DerivedThermoState
+  constexpr int ps_state = DerivedThermoState::Pack::n;
   // Set required (input) fields here
-  add_field<Required>("p_mid" , scalar3d_layout_mid, Pa, grid_name, ps);
+  add_field<Required>("p_mid" , scalar3d_layout_mid, Pa, grid_name, ps_state);
   add_field<Required>("p_int", scalar3d_layout_int, Pa, grid_name, ps);
-  add_field<Required>("pseudo_density", scalar3d_layout_mid, Pa, grid_name, ps);
+  add_field<Required>("pseudo_density", scalar3d_layout_mid, Pa, grid_name, ps_state);
   add_field<Required>("sfc_alb_dir_vis", scalar2d_layout, nondim, grid_name);
   add_field<Required>("sfc_alb_dir_nir", scalar2d_layout, nondim, grid_name);
   add_field<Required>("sfc_alb_dif_vis", scalar2d_layout, nondim, grid_name);
@@ -95,7 +97,7 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   add_field<Required>("cldfrac_tot", scalar3d_layout_mid, nondim, grid_name, ps);
   add_field<Required>("eff_radius_qc", scalar3d_layout_mid, micron, grid_name, ps);
   add_field<Required>("eff_radius_qi", scalar3d_layout_mid, micron, grid_name, ps);
-  add_field<Required>("qv",scalar3d_layout_mid,kgkg,grid_name, ps);
+  add_field<Required>("qv",scalar3d_layout_mid,kgkg,grid_name, ps_state);
   add_field<Required>("surf_lw_flux_up",scalar2d_layout,W/(m*m),grid_name);
   // Set of required gas concentration fields
   for (auto& it : m_gas_names) {
@@ -118,7 +120,7 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   }
 
   // Set computed (output) fields
-  add_field<Updated >("T_mid"     , scalar3d_layout_mid, K  , grid_name, ps);
+  add_field<Updated >("T_mid"     , scalar3d_layout_mid, K  , grid_name, ps_state);
   add_field<Computed>("SW_flux_dn", scalar3d_layout_int, Wm2, grid_name, ps);
   add_field<Computed>("SW_flux_up", scalar3d_layout_int, Wm2, grid_name, ps);
   add_field<Computed>("SW_flux_dn_dir", scalar3d_layout_int, Wm2, grid_name, ps);
@@ -261,6 +263,8 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   mem += m_buffer.lw_clrsky_flux_up.totElems();
   m_buffer.lw_clrsky_flux_dn = decltype(m_buffer.lw_clrsky_flux_dn)("lw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
   mem += m_buffer.lw_clrsky_flux_dn.totElems();
+  m_buffer.d_tint = decltype(m_buffer.d_tint)(mem, m_col_chunk_size, m_nlay+1);
+  mem += m_buffer.d_tint.size();
   // 3d arrays with nswbands dimension (shortwave fluxes by band)
   m_buffer.sw_bnd_flux_up = decltype(m_buffer.sw_bnd_flux_up)("sw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_up.totElems();
@@ -360,6 +364,10 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
           m_atm_logger
   );
 
+  // dz is shared with the other processes/diagnostics using the same state fields
+  m_derived_state = DerivedThermoState::get_instance(get_field_in("T_mid"),get_field_in("p_mid"),
+                                                     get_field_in("pseudo_density"),get_field_in("qv"));
+
   // Set property checks for fields in this process
   add_invariant_check<FieldWithinIntervalCheck>(get_field_out("T_mid"),m_grid,100.0, 500.0,false);
 }
@@ -371,9 +379,9 @@ void RRTMGPRadiation::run_impl (const double dt) {
   using PC = scream::physics::Constants<Real>;
   using CO = scream::ColumnOps<DefaultDevice,Real>;
 
-  // get a host copy of lat/lon
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
+  // get a device copy of lat/lon
+  auto d_lat  = m_lat.get_view<const Real*>();
+  auto d_lon  = m_lon.get_view<const Real*>();
 
   // Get data from the FieldManager
   auto d_pmid = get_field_in("p_mid").get_view<const Real**>();
@@ -473,6 +481,10 @@ void RRTMGPRadiation::run_impl (const double dt) {
     shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
                      obliqr, &delta, &eccf);
 
+    // dz is computed from the input state (i.e., before T_mid is updated below),
+    // and reused if nobody changed the state since it was last computed
+    const auto d_dz = m_derived_state->get_dz().get_view<const Real**>();
+
     // Loop over each chunk of columns
     for (int ic=0; ic<m_num_col_chunks; ++ic) {
       const int beg  = m_col_chunk_beg[ic];
@@ -543,42 +555,33 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
       // Copy data from the FieldManager to the YAKL arrays
       {
-        // Determine the cosine zenith angle
-        // NOTE: Since we are bridging to F90 arrays this must be done on HOST and then
-        //       deep copied to a device view.
-        auto d_mu0 = m_buffer.cosine_zenith;
-        auto h_mu0 = Kokkos::create_mirror_view(d_mu0);
-        if (m_fixed_solar_zenith_angle > 0) {
-          for (int i=0; i<ncol; i++) {
-            h_mu0(i) = m_fixed_solar_zenith_angle;
-          }
-        } else {
-          // Now use solar declination to calculate zenith angle for all points
-          for (int i=0;i<ncol;i++) {
-            double lat = h_lat(i+beg)*PC::Pi/180.0;  // Convert lat/lon to radians
-            double lon = h_lon(i+beg)*PC::Pi/180.0;
-            h_mu0(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, m_rad_freq_in_steps * dt);
-          }
-        }
-        Kokkos::deep_copy(d_mu0,h_mu0);
+        // The cosine zenith angle is computed on device, using the C++ port of
+        // shr_orb_cosz, so that no host work or host-device copy is needed here.
+        const auto d_mu0 = m_buffer.cosine_zenith;
+        const Real fixed_solar_zenith_angle = m_fixed_solar_zenith_angle;
+        const double dt_avg = m_rad_freq_in_steps * dt;
 
-        // dz and T_int will need to be computed
-        view_2d_real d_tint("T_int", ncol, m_nlay+1);
-        view_2d_real d_dz  ("dz",    ncol, m_nlay);
+        // T_int will need to be computed, and lives in the buffer
+        const auto d_tint = m_buffer.d_tint;
 
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           const int icol = i+beg;
 
-          // Calculate dz
-          const auto pseudo_density = ekat::subview(d_pdel, icol);
-          const auto p_mid          = ekat::subview(d_pmid, icol);
-          const auto T_mid          = ekat::subview(d_tmid, icol);
-          const auto qv             = ekat::subview(d_qv,   icol);
-          const auto dz             = ekat::subview(d_dz,   i);
-          PF::calculate_dz<Real>(team, pseudo_density, p_mid, T_mid, qv, dz);
-          team.team_barrier();
+          Kokkos::single(Kokkos::PerTeam(team), [&] {
+            if (fixed_solar_zenith_angle > 0) {
+              d_mu0(i) = fixed_solar_zenith_angle;
+            } else {
+              // Use solar declination to calculate zenith angle (convert lat/lon to radians)
+              const double lat = d_lat(icol)*PC::Pi/180.0;
+              const double lon = d_lon(icol)*PC::Pi/180.0;
+              d_mu0(i) = scream::rrtmgp::orbital_cos_zenith(calday, lat, lon, delta, dt_avg);
+            }
+          });
+
+          const auto T_mid = ekat::subview(d_tmid, icol);
+          const auto dz    = ekat::subview(d_dz,   icol);
 
           // Calculate T_int from longwave flux up from the surface, assuming
           // blackbody emission with emissivity of 1.
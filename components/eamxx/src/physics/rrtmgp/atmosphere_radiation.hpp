@@ -4,6 +4,7 @@
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #include "physics/rrtmgp/scream_rrtmgp_interface.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/field/derived_thermo_state.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 #include <string>
@@ -25,6 +26,8 @@ public:
   using KT               = ekat::KokkosTypes<DefaultDevice>;
   template<typename ScalarT>
   using uview_1d         = Unmanaged<typename KT::template view_1d<ScalarT>>;
+  template<typename ScalarT>
+  using uview_2d         = Unmanaged<typename KT::template view_2d<ScalarT>>;
 
   // Constructors
   RRTMGPRadiation (const ekat::Comm& comm, const ekat::ParameterList& params);
@@ -104,7 +107,7 @@ public:
   struct Buffer {
     static constexpr int num_1d_ncol        = 10;
     static constexpr int num_2d_nlay        = 13;
-    static constexpr int num_2d_nlay_p1     = 12;
+    static constexpr int num_2d_nlay_p1     = 13;
     static constexpr int num_2d_nswbands    = 2;
     static constexpr int num_3d_nlev_nswbands = 4;
     static constexpr int num_3d_nlev_nlwbands = 2;
@@ -153,6 +156,7 @@ public:
     real2d sw_clrsky_flux_dn_dir;
     real2d lw_clrsky_flux_up;
     real2d lw_clrsky_flux_dn;
+    uview_2d<Real> d_tint;
 
     // 3d size (ncol, nlay+1, nswbands)
     real3d sw_bnd_flux_up;
@@ -190,6 +194,9 @@ protected:
 
   std::shared_ptr<const AbstractGrid>   m_grid;
 
+  // Cache of dz, shared with the other clients of the atmosphere state
+  std::shared_ptr<DerivedThermoState>   m_derived_state;
+
   // Struct which contains local variables
   Buffer m_buffer;
 };  // class RRTMGPRadiation
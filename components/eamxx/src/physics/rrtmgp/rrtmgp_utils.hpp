@@ -2,6 +2,7 @@
 #define RRTMGP_UTILS_HPP
 
 #include "physics/share/physics_constants.hpp"
+#include "ekat/util/ekat_math_utils.hpp"
 #include "cpp/rrtmgp_const.h"
 #include "YAKL.h"
 #include "YAKL_Bounds_fortran.h"
@@ -52,6 +53,86 @@ namespace scream {
             }
         }
 
+        // C++ port of shr_orb_avg_cosz (share/util/shr_orb_mod.F90), which computes
+        // the cosine of the solar zenith angle averaged over [jday, jday+dt_avg],
+        // following Zhou et al., GRL, 2015. Angles are in radians, dt_avg in seconds.
+        KOKKOS_INLINE_FUNCTION
+        double orbital_avg_cos_zenith (const double jday, const double lat, const double lon,
+                                       const double declin, const double dt_avg) {
+            using ekat::impl::min;
+            using ekat::impl::max;
+            constexpr double pi      = scream::physics::Constants<double>::Pi;
+            constexpr double piover2 = pi/2.0;
+            constexpr double twopi   = pi*2.0;
+
+            // Adjust latitude and declination so that their tangent is defined
+            const double del = lat    ==  piover2 ? lat    - 1.0e-05
+                             : lat    == -piover2 ? lat    + 1.0e-05 : lat;
+            const double phi = declin ==  piover2 ? declin - 1.0e-05
+                             : declin == -piover2 ? declin + 1.0e-05 : declin;
+
+            // Half-day length, adjusted for the cases of all daylight or all night
+            const double cos_h = -tan(del)*tan(phi);
+            const double h = cos_h <= -1.0 ? pi : (cos_h >= 1.0 ? 0.0 : acos(cos_h));
+
+            // Local time t and t+dt, with t in [-pi,pi)
+            double t1 = (jday - static_cast<int>(jday))*twopi + lon - pi;
+            if (t1 >= pi) {
+                t1 -= twopi;
+            } else if (t1 < -pi) {
+                t1 += twopi;
+            }
+            const double dt = dt_avg / 86400.0 * twopi;
+            const double t2 = t1 + dt;
+
+            const double aa = sin(lat)*sin(declin);
+            const double bb = cos(lat)*cos(declin);
+
+            // Hour angle, forced to be in [-h,h], taking care of short nights
+            double tt1, tt2, tt3, tt4;
+            if (t2 >= pi && t1 <= pi && pi - h <= dt) {
+                tt2 = h;
+                tt1 = min(max(t1, -h), h);
+                tt4 = min(max(t2, twopi - h), twopi + h);
+                tt3 = twopi - h;
+            } else if (t2 >= -pi && t1 <= -pi && pi - h <= dt) {
+                tt2 = -twopi + h;
+                tt1 = min(max(t1, -twopi - h), -twopi + h);
+                tt4 = min(max(t2, -h), h);
+                tt3 = -h;
+            } else {
+                const double t2w = t2 > pi ? t2 - twopi : (t2 < -pi ? t2 + twopi : t2);
+                const double t1w = t1 > pi ? t1 - twopi : (t1 < -pi ? t1 + twopi : t1);
+                tt2 = min(max(t2w, -h), h);
+                tt1 = min(max(t1w, -h), h);
+                tt4 = 0.0;
+                tt3 = 0.0;
+            }
+
+            if (tt2 > tt1 || tt4 > tt3) {
+                return (aa*(tt2 - tt1) + bb*(sin(tt2) - sin(tt1)))/dt +
+                       (aa*(tt4 - tt3) + bb*(sin(tt4) - sin(tt3)))/dt;
+            } else {
+                return 0.0;
+            }
+        }
+
+        // C++ port of shr_orb_cosz (share/util/shr_orb_mod.F90), so that the cosine
+        // of the solar zenith angle can be computed on device. If dt_avg is nonzero,
+        // the value is averaged over the following dt_avg seconds.
+        // NOTE: the constant_zenith_angle_deg override of the Fortran version is
+        //       not ported, since scream never sets it.
+        KOKKOS_INLINE_FUNCTION
+        double orbital_cos_zenith (const double jday, const double lat, const double lon,
+                                   const double declin, const double dt_avg) {
+            constexpr double pi = scream::physics::Constants<double>::Pi;
+            if (dt_avg != 0.0) {
+                return orbital_avg_cos_zenith(jday, lat, lon, declin, dt_avg);
+            } else {
+                return sin(lat)*sin(declin) - cos(lat)*cos(declin)*cos((jday - floor(jday))*2.0*pi + lon);
+            }
+        }
+
 
         // Verify that array only contains values within valid range, and if not
         // report min and max of array
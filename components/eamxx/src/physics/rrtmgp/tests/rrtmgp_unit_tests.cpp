@@ -207,6 +207,9 @@ TEST_CASE("rrtmgp_test_zenith") {
     double dt_avg = 0.; //3600.0000000000000;
     double coszrs = shr_orb_cosz_c2f(calday, lat, lon, delta, dt_avg);
     REQUIRE(std::abs(coszrs-coszrs_ref)<1e-14);
+    // The C++ port must match the Fortran implementation
+    coszrs = scream::rrtmgp::orbital_cos_zenith(calday, lat, lon, delta, dt_avg);
+    REQUIRE(std::abs(coszrs-coszrs_ref)<1e-14);
 
     // Another case, this time WITH dt_avg flag:
     calday = 1.0833333333333333;
@@ -222,6 +225,8 @@ TEST_CASE("rrtmgp_test_zenith") {
     coszrs_ref = 0.14559973262047626;
     coszrs = shr_orb_cosz_c2f(calday, lat, lon, delta, dt_avg);
     REQUIRE(std::abs(coszrs-coszrs_ref)<1e-14);
+    coszrs = scream::rrtmgp::orbital_cos_zenith(calday, lat, lon, delta, dt_avg);
+    REQUIRE(std::abs(coszrs-coszrs_ref)<1e-14);
 
 }
 
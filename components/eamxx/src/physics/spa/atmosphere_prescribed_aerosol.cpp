@@ -2,6 +2,7 @@
 
 #include "share/util/scream_time_stamp.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/io/scream_io_worker.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/property_checks/field_lower_bound_check.hpp"
 
@@ -182,11 +183,18 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPAData_start = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
   SPAData_end   = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
 
+  // Set up the reader for the SPA data. The reader is kept for the whole run, and prefetches
+  // the next month of data in the background (if MPI supports it).
+  if (not scorpio::IOWorker::is_supported() && m_comm.am_i_root()) {
+    printf("WARNING: MPI does not provide MPI_THREAD_MULTIPLE - SPA data will be prefetched synchronously\n");
+  }
+  SPAFunc::init_spa_reader(m_spa_data_file,m_nswbands,m_nlwbands,SPAHorizInterp,true,SPADataReader);
+
   // Update the local time state information and load the first set of SPA data for interpolation:
   auto ts = timestamp();
   SPATimeState.inited = false;
   SPATimeState.current_month = ts.get_month();
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPADataReader,SPATimeState,SPAData_start,SPAData_end);
 
   // Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
@@ -208,7 +216,7 @@ void SPA::run_impl (const double dt)
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
   /* Update time state and if the month has changed, update the data.*/
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPADataReader,SPATimeState,SPAData_start,SPAData_end);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Pack**>();
@@ -219,7 +227,7 @@ void SPA::run_impl (const double dt)
 // =========================================================================================
 void SPA::finalize_impl()
 {
-  // Do nothing
+  SPAFunc::finalize_spa_reader(SPADataReader);
 }
 
 } // namespace scream
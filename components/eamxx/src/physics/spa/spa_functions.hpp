@@ -3,6 +3,7 @@
 
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/remap/horizontal_remap_utility.hpp"
+#include "share/io/scorpio_input.hpp"
 #include "share/scream_types.hpp"
 #include "share/util/scream_time_stamp.hpp"
 
@@ -160,6 +161,37 @@ struct SPAFunctions
     ekat::Comm m_comm;
 
   }; // SPAHorizInterp
+
+  struct SPAReader {
+    // This structure caches the input object (and thus the scorpio decomposition)
+    // used to read the SPA data file, together with host staging views that hold
+    // one month of source data. Reading a month into the staging views can be
+    // done asynchronously on the scorpio IO worker thread, so that the next month
+    // is prefetched while the current one is in use.
+    SPAReader() = default;
+
+    // Input object, and the grid of unique source columns it reads
+    std::shared_ptr<AtmosphereInput>    input;
+    std::shared_ptr<const AbstractGrid> grid;
+
+    int source_data_nlevs = -1;
+    int num_src_cols      = -1;
+    // Time index (zero-based) of the data currently staged (or being read)
+    int time_index        = -1;
+
+    // Whether reads happen on the IO worker thread, and the ticket of the last read
+    bool      async  = false;
+    long long ticket = 0;
+
+    // Source data on device, which is then remapped, and the host staging views
+    view_1d_host<Real> hyam, hybm;
+    view_1d<Real> PS;
+    view_2d<Real> CCN3;
+    view_3d<Real> AER_G_SW, AER_SSA_SW, AER_TAU_SW, AER_TAU_LW;
+    typename view_1d<Real>::HostMirror PS_h;
+    typename view_2d<Real>::HostMirror CCN3_h;
+    typename view_3d<Real>::HostMirror AER_G_SW_h, AER_SSA_SW_h, AER_TAU_SW_h, AER_TAU_LW_h;
+  }; // SPAReader
   /* ------------------------------------------------------------------------------------------- */
   // SPA routines
   static void spa_main(
@@ -190,12 +222,38 @@ struct SPAFunctions
           SPAHorizInterp& spa_horiz_interp,
           SPAInput&       spa_data);
 
+  // Set up the reader of the SPA data file, based on the unique source dofs of the remap.
+  // If async is true (and supported by MPI), reads happen on the IO worker thread.
+  static void init_spa_reader(
+    const std::string&    spa_data_file_name,
+    const int             nswbands,
+    const int             nlwbands,
+    const SPAHorizInterp& spa_horiz_interp,
+    const bool            async,
+          SPAReader&      spa_reader);
+
+  // Start reading the given time index into the reader staging views
+  static void read_spa_data (
+    const int        time_index,
+          SPAReader& spa_reader);
+
+  // Wait for the staged data, then copy it to device, remap it, and pad it into spa_data
+  static void remap_spa_data (
+    const int             nswbands,
+    const int             nlwbands,
+          SPAHorizInterp& spa_horiz_interp,
+          SPAReader&      spa_reader,
+          SPAInput&       spa_data);
+
+  // Wait for any pending read, and close the data file
+  static void finalize_spa_reader (SPAReader& spa_reader);
+
   static void update_spa_timestate(
-    const std::string&     spa_data_file_name,
     const int              nswbands,
     const int              nlwbands,
     const util::TimeStamp& ts,
           SPAHorizInterp&  spa_horiz_interp,
+          SPAReader&       spa_reader,
           SPATimeState&    time_state,
           SPAInput&        spa_beg,
           SPAInput&        spa_end);
@@ -4,6 +4,7 @@
 #include "share/scream_types.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_io_worker.hpp"
 #include "share/grid/point_grid.hpp"
 #include "physics/share/physics_constants.hpp"
 
@@ -406,59 +407,71 @@ void SPAFunctions<S,D>
           SPAInput&             spa_data)
 {
   start_timer("EAMxx::SPA::update_spa_data_from_file");
+  // One-shot, synchronous read of a single time slice
+  SPAReader spa_reader;
+  init_spa_reader(spa_data_file_name,nswbands,nlwbands,spa_horiz_interp,false,spa_reader);
+  read_spa_data(time_index,spa_reader);
+  remap_spa_data(nswbands,nlwbands,spa_horiz_interp,spa_reader,spa_data);
+  finalize_spa_reader(spa_reader);
+  stop_timer("EAMxx::SPA::update_spa_data_from_file");
+
+} // END update_spa_data_from_file
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::init_spa_reader(
+    const std::string&    spa_data_file_name,
+    const int             nswbands,
+    const int             nlwbands,
+    const SPAHorizInterp& spa_horiz_interp,
+    const bool            async,
+          SPAReader&      spa_reader)
+{
+  start_timer("EAMxx::SPA::init_spa_reader");
   // Ensure all ranks are operating independently when reading the file, so there's a copy on all ranks
   auto comm = spa_horiz_interp.m_comm;
 
   // Use HorizontalMap to define the set of source column data we need to load
-  auto& spa_horiz_map = spa_horiz_interp.horiz_map;
+  const auto& spa_horiz_map = spa_horiz_interp.horiz_map;
   auto unique_src_dofs = spa_horiz_map.get_unique_source_dofs();
   const int num_local_cols = spa_horiz_map.get_num_unique_dofs();
   scorpio::register_file(spa_data_file_name,scorpio::Read);
   const int source_data_nlevs = scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lev");
+  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"swband"),"ERROR init_spa_reader: Number of SW bands in simulation doesn't match the SPA data file");
+  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lwband"),"ERROR init_spa_reader: Number of LW bands in simulation doesn't match the SPA data file");
   scorpio::eam_pio_closefile(spa_data_file_name);
 
-  // Construct local arrays to read data into
-  // Note, all of the views being created here are meant to hold the source resolution
-  // data that will need to be horizontally interpolated to the simulation grid using the remap
-  // data.  For example, 
-  //   We will first define the data surface pressure PS_v and read that from file.
-  //   then we will use the horizontal interpolation structure, spa_horiz_interp, to
-  //   interpolate PS_v onto the simulation grid: PS_v -> spa_data.PS
-  //   and so on for the other variables.
-  start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
-  std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
-  ekat::ParameterList spa_data_in_params;
-  spa_data_in_params.set("Field Names",fnames);
-  spa_data_in_params.set("Filename",spa_data_file_name);
-  spa_data_in_params.set("Skip_Grid_Checks",true);  // We need to skip grid checks because multiple ranks may want the same column of source data.
-  AtmosphereInput spa_data_input(comm,spa_data_in_params);
-  
+  spa_reader.source_data_nlevs = source_data_nlevs;
+  spa_reader.num_src_cols      = num_local_cols;
+  spa_reader.time_index        = -1;
+  spa_reader.async             = async && scorpio::IOWorker::is_supported();
+
   // Construct the grid needed for input:
   auto grid = std::make_shared<PointGrid>("grid",num_local_cols,source_data_nlevs,comm);
   Kokkos::deep_copy(grid->get_dofs_gids().template get_view<gid_type*>(),unique_src_dofs);
   grid->get_dofs_gids().sync_to_host();
-
-  // Check that padding matches source size:
-  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
-  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"swband"),"ERROR update_spa_data_from_file: Number of SW bands in simulation doesn't match the SPA data file");
-  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lwband"),"ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
-
-  // Constuct views to read source data in from file
-  typename view_1d<Real>::HostMirror hyam_v_h("hyam",source_data_nlevs);
-  typename view_1d<Real>::HostMirror hybm_v_h("hybm",source_data_nlevs);
-  view_1d<Real> PS_v("PS",num_local_cols);
-  view_2d<Real> CCN3_v("CCN3",num_local_cols,source_data_nlevs);
-  view_3d<Real> AER_G_SW_v("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
-
-  auto PS_v_h         = Kokkos::create_mirror_view(PS_v);
-  auto CCN3_v_h       = Kokkos::create_mirror_view(CCN3_v);      
-  auto AER_G_SW_v_h   = Kokkos::create_mirror_view(AER_G_SW_v);
-  auto AER_SSA_SW_v_h = Kokkos::create_mirror_view(AER_SSA_SW_v);
-  auto AER_TAU_SW_v_h = Kokkos::create_mirror_view(AER_TAU_SW_v);
-  auto AER_TAU_LW_v_h = Kokkos::create_mirror_view(AER_TAU_LW_v);
+  spa_reader.grid = grid;
+
+  // Construct the host staging views, as well as the device views that the data
+  // is copied to before being remapped.
+  // Note, all of the source views hold the source resolution data that will need
+  // to be horizontally interpolated to the simulation grid using the remap data.
+  spa_reader.hyam       = view_1d_host<Real>("hyam",source_data_nlevs);
+  spa_reader.hybm       = view_1d_host<Real>("hybm",source_data_nlevs);
+  spa_reader.PS         = view_1d<Real>("PS",num_local_cols);
+  spa_reader.CCN3       = view_2d<Real>("CCN3",num_local_cols,source_data_nlevs);
+  spa_reader.AER_G_SW   = view_3d<Real>("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
+  spa_reader.AER_SSA_SW = view_3d<Real>("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
+  spa_reader.AER_TAU_SW = view_3d<Real>("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
+  spa_reader.AER_TAU_LW = view_3d<Real>("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
+
+  spa_reader.PS_h         = Kokkos::create_mirror_view(spa_reader.PS);
+  spa_reader.CCN3_h       = Kokkos::create_mirror_view(spa_reader.CCN3);
+  spa_reader.AER_G_SW_h   = Kokkos::create_mirror_view(spa_reader.AER_G_SW);
+  spa_reader.AER_SSA_SW_h = Kokkos::create_mirror_view(spa_reader.AER_SSA_SW);
+  spa_reader.AER_TAU_SW_h = Kokkos::create_mirror_view(spa_reader.AER_TAU_SW);
+  spa_reader.AER_TAU_LW_h = Kokkos::create_mirror_view(spa_reader.AER_TAU_LW);
 
   // Set up input structure to read data from file.
   using namespace ShortFieldTagsNames;
@@ -470,45 +483,106 @@ void SPAFunctions<S,D>
   std::map<std::string,view_1d_host<Real>> host_views;
   std::map<std::string,FieldLayout>  layouts;
   // Define each input variable we need
-  host_views["hyam"] = view_1d_host<Real>(hyam_v_h.data(),hyam_v_h.size());
+  host_views["hyam"] = spa_reader.hyam;
   layouts.emplace("hyam", scalar1d_layout);
-  host_views["hybm"] = view_1d_host<Real>(hybm_v_h.data(),hybm_v_h.size());
+  host_views["hybm"] = spa_reader.hybm;
   layouts.emplace("hybm", scalar1d_layout);
   //
-  host_views["PS"] = view_1d_host<Real>(PS_v_h.data(),PS_v_h.size());
+  host_views["PS"] = view_1d_host<Real>(spa_reader.PS_h.data(),spa_reader.PS_h.size());
   layouts.emplace("PS", scalar2d_layout_mid);
   //
-  host_views["CCN3"] = view_1d_host<Real>(CCN3_v_h.data(),CCN3_v_h.size());
+  host_views["CCN3"] = view_1d_host<Real>(spa_reader.CCN3_h.data(),spa_reader.CCN3_h.size());
   layouts.emplace("CCN3",scalar3d_layout_mid);
   //
-  host_views["AER_G_SW"] = view_1d_host<Real>(AER_G_SW_v_h.data(),AER_G_SW_v_h.size());
+  host_views["AER_G_SW"] = view_1d_host<Real>(spa_reader.AER_G_SW_h.data(),spa_reader.AER_G_SW_h.size());
   layouts.emplace("AER_G_SW",scalar3d_swband_layout);
   //
-  host_views["AER_SSA_SW"] = view_1d_host<Real>(AER_SSA_SW_v_h.data(),AER_SSA_SW_v_h.size());
+  host_views["AER_SSA_SW"] = view_1d_host<Real>(spa_reader.AER_SSA_SW_h.data(),spa_reader.AER_SSA_SW_h.size());
   layouts.emplace("AER_SSA_SW",scalar3d_swband_layout);
   //
-  host_views["AER_TAU_SW"] = view_1d_host<Real>(AER_TAU_SW_v_h.data(),AER_TAU_SW_v_h.size());
+  host_views["AER_TAU_SW"] = view_1d_host<Real>(spa_reader.AER_TAU_SW_h.data(),spa_reader.AER_TAU_SW_h.size());
   layouts.emplace("AER_TAU_SW",scalar3d_swband_layout);
   //
-  host_views["AER_TAU_LW"] = view_1d_host<Real>(AER_TAU_LW_v_h.data(),AER_TAU_LW_v_h.size());
+  host_views["AER_TAU_LW"] = view_1d_host<Real>(spa_reader.AER_TAU_LW_h.data(),spa_reader.AER_TAU_LW_h.size());
   layouts.emplace("AER_TAU_LW",scalar3d_lwband_layout);
   //
-  
-  // Now that we have all the variables defined we can use the scorpio_input class to grab the data.
-  spa_data_input.init(grid,host_views,layouts);
-  spa_data_input.read_variables(time_index);
-  spa_data_input.finalize();
-  stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+
+  std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
+  ekat::ParameterList spa_data_in_params;
+  spa_data_in_params.set("Field Names",fnames);
+  spa_data_in_params.set("Filename",spa_data_file_name);
+  spa_data_in_params.set("Skip_Grid_Checks",true);  // We need to skip grid checks because multiple ranks may want the same column of source data.
+  spa_reader.input = std::make_shared<AtmosphereInput>(comm,spa_data_in_params);
+  spa_reader.input->init(grid,host_views,layouts);
+  stop_timer("EAMxx::SPA::init_spa_reader");
+} // END init_spa_reader
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::read_spa_data(
+    const int        time_index, // zero-based
+          SPAReader& spa_reader)
+{
+  EKAT_REQUIRE_MSG(spa_reader.input!=nullptr,"ERROR read_spa_data: SPA reader was not initialized.");
+
+  // Do not start overwriting the staging views while a previous read is in flight
+  if (spa_reader.async) {
+    scorpio::IOWorker::instance().wait(spa_reader.ticket);
+  }
+
+  spa_reader.time_index = time_index;
+  auto input = spa_reader.input;
+  auto read = [input,time_index]() {
+    input->read_variables(time_index);
+  };
+  if (spa_reader.async) {
+    spa_reader.ticket = scorpio::IOWorker::instance().submit(read);
+  } else {
+    start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+    read();
+    stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+  }
+} // END read_spa_data
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::remap_spa_data(
+    const int             nswbands,
+    const int             nlwbands,
+          SPAHorizInterp& spa_horiz_interp,
+          SPAReader&      spa_reader,
+          SPAInput&       spa_data)
+{
+  EKAT_REQUIRE_MSG(spa_reader.time_index>=0,"ERROR remap_spa_data: no SPA data was read yet.");
+  if (spa_reader.async) {
+    start_timer("EAMxx::SPA::update_spa_data_from_file::wait_for_read");
+    scorpio::IOWorker::instance().wait(spa_reader.ticket);
+    stop_timer("EAMxx::SPA::update_spa_data_from_file::wait_for_read");
+  }
+
+  const int source_data_nlevs = spa_reader.source_data_nlevs;
+  // Check that padding matches source size:
+  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
+
   start_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
-  // Copy data from host back to the device views.
-  Kokkos::deep_copy(PS_v,PS_v_h);
-  Kokkos::deep_copy(CCN3_v      , CCN3_v_h);      
-  Kokkos::deep_copy(AER_G_SW_v  , AER_G_SW_v_h);
-  Kokkos::deep_copy(AER_SSA_SW_v, AER_SSA_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_SW_v, AER_TAU_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_LW_v, AER_TAU_LW_v_h);
+  // Copy data from the host staging views to the device views.
+  const auto& PS_v         = spa_reader.PS;
+  const auto& CCN3_v       = spa_reader.CCN3;
+  const auto& AER_G_SW_v   = spa_reader.AER_G_SW;
+  const auto& AER_SSA_SW_v = spa_reader.AER_SSA_SW;
+  const auto& AER_TAU_SW_v = spa_reader.AER_TAU_SW;
+  const auto& AER_TAU_LW_v = spa_reader.AER_TAU_LW;
+  Kokkos::deep_copy(PS_v        , spa_reader.PS_h);
+  Kokkos::deep_copy(CCN3_v      , spa_reader.CCN3_h);
+  Kokkos::deep_copy(AER_G_SW_v  , spa_reader.AER_G_SW_h);
+  Kokkos::deep_copy(AER_SSA_SW_v, spa_reader.AER_SSA_SW_h);
+  Kokkos::deep_copy(AER_TAU_SW_v, spa_reader.AER_TAU_SW_h);
+  Kokkos::deep_copy(AER_TAU_LW_v, spa_reader.AER_TAU_LW_h);
 
   // Apply the remap to this data
+  auto& spa_horiz_map = spa_horiz_interp.horiz_map;
   spa_horiz_map.apply_remap(PS_v,spa_data.PS); // Note PS is not padded, so remap can be applied right away
   // For padded data we need create temporary arrays to store the direct remapped data, then we can add
   // padding.
@@ -597,8 +671,8 @@ void SPAFunctions<S,D>
   for (int kk=0; kk<source_data_nlevs; kk++) {
     int pack = (kk+1) / Spack::n; 
     int kidx = (kk+1) % Spack::n;
-    hyam_h(pack)[kidx] = hyam_v_h(kk);
-    hybm_h(pack)[kidx] = hybm_v_h(kk);
+    hyam_h(pack)[kidx] = spa_reader.hyam(kk);
+    hybm_h(pack)[kidx] = spa_reader.hybm(kk);
   }
   const int pack = (source_data_nlevs+1) / Spack::n;
   const int kidx = (source_data_nlevs+1) % Spack::n;
@@ -606,19 +680,32 @@ void SPAFunctions<S,D>
   hybm_h(pack)[kidx] = 0.0;
   Kokkos::deep_copy(spa_data.hyam,hyam_h);
   Kokkos::deep_copy(spa_data.hybm,hybm_h);
-  stop_timer("EAMxx::SPA::update_spa_data_from_file");
 
-} // END update_spa_data_from_file
+} // END remap_spa_data
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::finalize_spa_reader(SPAReader& spa_reader)
+{
+  if (spa_reader.input) {
+    if (spa_reader.async) {
+      scorpio::IOWorker::instance().wait(spa_reader.ticket);
+    }
+    spa_reader.input->finalize();
+    spa_reader.input = nullptr;
+  }
+} // END finalize_spa_reader
 
 /*-----------------------------------------------------------------*/
 template<typename S, typename D>
 void SPAFunctions<S,D>
 ::update_spa_timestate(
-  const std::string&     spa_data_file_name,
   const int              nswbands,
   const int              nlwbands,
   const util::TimeStamp& ts,
         SPAHorizInterp&  spa_horiz_interp,
+        SPAReader&       spa_reader,
         SPATimeState&    time_state, 
         SPAInput&        spa_beg,
         SPAInput&        spa_end)
@@ -629,6 +716,7 @@ void SPAFunctions<S,D>
   //        any other frequency.
   const auto month = ts.get_month();
   if (month != time_state.current_month or !time_state.inited) {
+    const int prev_month = time_state.current_month;
 
     // Update the SPA time state information
     time_state.current_month = month;
@@ -640,9 +728,25 @@ void SPAFunctions<S,D>
     //       to be assigned.  A timestep greater than a month is very unlikely so we
     //       will proceed.
     // NOTE: we use zero-based time indexing here.
-    update_spa_data_from_file(spa_data_file_name,time_state.current_month-1,nswbands,nlwbands,spa_horiz_interp,spa_beg);
-    int next_month = time_state.current_month==12 ? 1 : time_state.current_month+1;
-    update_spa_data_from_file(spa_data_file_name,next_month-1,nswbands,nlwbands,spa_horiz_interp,spa_end);
+    const int next_month = time_state.current_month==12 ? 1 : time_state.current_month+1;
+    const int prev_next_month = prev_month==12 ? 1 : prev_month+1;
+    if (time_state.inited && month==prev_next_month) {
+      // Last month's end data is this month's beginning data
+      std::swap(spa_beg,spa_end);
+    } else {
+      read_spa_data(time_state.current_month-1,spa_reader);
+      remap_spa_data(nswbands,nlwbands,spa_horiz_interp,spa_reader,spa_beg);
+    }
+    // The next month should already be (being) prefetched, unless this is the first call
+    if (spa_reader.time_index!=next_month-1) {
+      read_spa_data(next_month-1,spa_reader);
+    }
+    remap_spa_data(nswbands,nlwbands,spa_horiz_interp,spa_reader,spa_end);
+
+    // Start prefetching the month after, so that no I/O is needed at the next month change
+    const int next_next_month = next_month==12 ? 1 : next_month+1;
+    read_spa_data(next_next_month-1,spa_reader);
+
     // If time state was not initialized it is now:
     time_state.inited = true;
   }
@@ -0,0 +1,152 @@
+#define CATCH_CONFIG_RUNNER
+#include "catch2/catch.hpp"
+
+#include "share/io/scream_scorpio_interface.hpp"
+#include "share/io/scream_io_worker.hpp"
+#include "share/scream_session.hpp"
+#include "physics/spa/spa_functions.hpp"
+
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <iostream>
+
+namespace {
+
+using namespace scream;
+using namespace spa;
+
+using SPAFunc = spa::SPAFunctions<Real, DefaultDevice>;
+using gid_type = SPAFunc::gid_type;
+
+template <typename S>
+using view_1d = typename KokkosTypes<DefaultDevice>::template view_1d<S>;
+
+// Check that two device views store exactly the same data
+template<typename ViewT>
+void check_equal (const ViewT& a, const ViewT& b)
+{
+  REQUIRE (a.size()==b.size());
+  auto a_h = Kokkos::create_mirror_view(a);
+  auto b_h = Kokkos::create_mirror_view(b);
+  Kokkos::deep_copy(a_h,a);
+  Kokkos::deep_copy(b_h,b);
+  using ST = typename ViewT::traits::value_type;
+  const auto a_ptr = reinterpret_cast<const ST*>(a_h.data());
+  const auto b_ptr = reinterpret_cast<const ST*>(b_h.data());
+  for (size_t i=0; i<a.size(); ++i) {
+    REQUIRE (a_ptr[i]==b_ptr[i]);
+  }
+}
+
+void check_equal (const SPAFunc::SPAInput& a, const SPAFunc::SPAInput& b)
+{
+  check_equal(a.PS,b.PS);
+  check_equal(a.hyam,b.hyam);
+  check_equal(a.hybm,b.hybm);
+  check_equal(a.data.CCN3,b.data.CCN3);
+  check_equal(a.data.AER_G_SW,b.data.AER_G_SW);
+  check_equal(a.data.AER_SSA_SW,b.data.AER_SSA_SW);
+  check_equal(a.data.AER_TAU_SW,b.data.AER_TAU_SW);
+  check_equal(a.data.AER_TAU_LW,b.data.AER_TAU_LW);
+}
+
+TEST_CASE("spa_prefetch","spa")
+{
+  ekat::Comm spa_comm(MPI_COMM_WORLD);
+  MPI_Fint fcomm = MPI_Comm_c2f(spa_comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  if (not scorpio::IOWorker::is_supported() && spa_comm.am_i_root()) {
+    std::cout << " MPI does not provide MPI_THREAD_MULTIPLE: SPA data will be read synchronously.\n";
+  }
+
+  // We need a full year of data, to cross the Dec->Jan boundary
+  std::string spa_data_file = SCREAM_DATA_DIR "/init/spa_file_unified_and_complete_ne4_scream.nc";
+  scorpio::register_file(spa_data_file,scorpio::Read);
+  const int ncols    = scorpio::get_dimlen_c2f(spa_data_file.c_str(),"ncol");
+  const int nlevs    = scorpio::get_dimlen_c2f(spa_data_file.c_str(),"lev");
+  const int ntimes   = scorpio::get_dimlen_c2f(spa_data_file.c_str(),"time");
+  scorpio::eam_pio_closefile(spa_data_file);
+  REQUIRE (ntimes==12);
+
+  // Same as the rrtmgp bands (see spa_main.yaml)
+  const int nswbands = 14;
+  const int nlwbands = 16;
+
+  // Break the set of columns into local degrees of freedom per mpi rank
+  const auto comm_size = spa_comm.size();
+  const auto comm_rank = spa_comm.rank();
+  const int my_ncols = ncols/comm_size + (comm_rank < ncols%comm_size ? 1 : 0);
+  view_1d<gid_type> dofs_gids("",my_ncols);
+  const gid_type min_dof = 0;
+  Kokkos::parallel_for("", my_ncols, KOKKOS_LAMBDA(const int& ii) {
+    dofs_gids(ii) = min_dof + static_cast<gid_type>(comm_rank + ii*comm_size);
+  });
+
+  SPAFunc::SPAHorizInterp spa_horiz_interp;
+  spa_horiz_interp.m_comm = spa_comm;
+  SPAFunc::set_remap_weights_one_to_one(min_dof,dofs_gids,spa_horiz_interp);
+
+  // Recall, SPA data is padded, so we initialize with 2 more levels than the source data file.
+  SPAFunc::SPAInput spa_ref(my_ncols, nlevs+2, nswbands, nlwbands);
+
+  // Run with and without prefetching on the IO worker thread
+  for (bool async : {false, true}) {
+    SPAFunc::SPAReader spa_reader;
+    SPAFunc::SPATimeState time_state;
+    SPAFunc::SPAInput spa_beg(my_ncols, nlevs+2, nswbands, nlwbands);
+    SPAFunc::SPAInput spa_end(my_ncols, nlevs+2, nswbands, nlwbands);
+    SPAFunc::init_spa_reader(spa_data_file,nswbands,nlwbands,spa_horiz_interp,async,spa_reader);
+
+    // Step daily from mid November to mid February, crossing the Nov->Dec,
+    // Dec->Jan (which changes year) and Jan->Feb boundaries.
+    util::TimeStamp ts ({2000,11,15},{0,0,0});
+    const util::TimeStamp t_end ({2001,2,15},{0,0,0});
+    int num_month_changes = 0;
+    while (ts<=t_end) {
+      const int prev_month = time_state.current_month;
+      SPAFunc::update_spa_timestate(nswbands,nlwbands,ts,spa_horiz_interp,spa_reader,
+                                    time_state,spa_beg,spa_end);
+      REQUIRE (time_state.current_month==ts.get_month());
+
+      if (time_state.current_month!=prev_month) {
+        // Beg/end data must match a fresh read of this month and the next one
+        const int month = ts.get_month();
+        const int next_month = month==12 ? 1 : month+1;
+        SPAFunc::update_spa_data_from_file(spa_data_file,month-1,nswbands,nlwbands,
+                                           spa_horiz_interp,spa_ref);
+        check_equal(spa_beg,spa_ref);
+        SPAFunc::update_spa_data_from_file(spa_data_file,next_month-1,nswbands,nlwbands,
+                                           spa_horiz_interp,spa_ref);
+        check_equal(spa_end,spa_ref);
+        ++num_month_changes;
+      }
+
+      ts += 86400;
+    }
+    // Initial month, plus Dec, Jan, and Feb
+    REQUIRE (num_month_changes==4);
+
+    SPAFunc::finalize_spa_reader(spa_reader);
+  }
+
+  scorpio::eam_pio_finalize();
+}
+
+} // anonymous namespace
+
+int main (int argc, char** argv) {
+  // The SPA reader can prefetch data on the IO worker thread, which issues MPI calls
+  int provided;
+  MPI_Init_thread(&argc,&argv,MPI_THREAD_MULTIPLE,&provided);
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  // The command line args are for the scream session (e.g., kokkos options)
+  scream::initialize_scream_session(argc,argv,comm.am_i_root());
+  const int num_failed = Catch::Session().run(1,argv);
+  scream::finalize_scream_session();
+
+  MPI_Finalize();
+  return num_failed!=0 ? 1 : 0;
+}
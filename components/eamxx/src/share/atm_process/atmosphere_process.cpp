@@ -76,7 +76,10 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 }
 
 void AtmosphereProcess::run (const double dt) {
-  start_timer (m_timer_prefix + this->name() + "::run");
+  if (m_run_timer_id<0) {
+    m_run_timer_id = register_timer (m_timer_prefix + this->name() + "::run");
+  }
+  start_timer (m_run_timer_id);
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -95,6 +98,10 @@ void AtmosphereProcess::run (const double dt) {
 
     run_impl(dt_sub);
 
+    // Time stamps are updated only at the end of the step (and not at all inside a
+    // subcycled group until its last iteration), so record the modification now.
+    mark_computed_fields_modified();
+
     if (has_column_conservation_check()) {
       // Run the column local mass and energy conservation checks
       run_column_conservation_check();
@@ -111,7 +118,7 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
-  stop_timer (m_timer_prefix + this->name() + "::run");
+  stop_timer (m_run_timer_id);
 }
 
 void AtmosphereProcess::finalize (/* what inputs? */) {
@@ -309,20 +316,50 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
   }
 }
 
+void AtmosphereProcess::run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                                             const FusedPropertyChecks&  fused_checks,
+                                             const PropertyCheckCategory property_check_category) const {
+  EKAT_REQUIRE_MSG (fused_checks.num_checks()==static_cast<int>(checks.size()),
+      "Error! Fused property checks out of sync with the list of checks.\n"
+      "  - Atmosphere process name: " + name() + "\n");
+
+  // Pre-screen all the pointwise checks with the fused kernels
+  const auto known_pass = fused_checks.run();
+
+  // Run individually only checks that may not pass, which also builds their message.
+  // If a check repairs some fields, the pre-screening of those fields is stale,
+  // so later checks on them must run individually too.
+  std::set<std::string> repaired;
+  int i = 0;
+  for (const auto& it : checks) {
+    const auto& pc = it.second;
+    bool skip = known_pass[i++];
+    for (const auto& f : pc->fields()) {
+      if (repaired.count(f.get_header().get_identifier().get_id_string())==1) {
+        skip = false;
+      }
+    }
+    if (skip) {
+      continue;
+    }
+
+    run_property_check(pc, it.first, property_check_category);
+    for (const auto& f : pc->repairable_fields()) {
+      repaired.insert(f->get_header().get_identifier().get_id_string());
+    }
+  }
+}
+
 void AtmosphereProcess::run_precondition_checks () const {
   // Run all pre-condition property checks
-  for (const auto& it : m_precondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Precondition);
-  }
+  run_property_checks(m_precondition_checks, m_fused_precondition_checks,
+                      PropertyCheckCategory::Precondition);
 }
 
 void AtmosphereProcess::run_postcondition_checks () const {
   // Run all post-condition property checks
-  for (const auto& it : m_postcondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Postcondition);
-  }
+  run_property_checks(m_postcondition_checks, m_fused_postcondition_checks,
+                      PropertyCheckCategory::Postcondition);
 }
 
 void AtmosphereProcess::run_column_conservation_check () const {
@@ -404,6 +441,21 @@ void AtmosphereProcess::update_time_stamps () {
   }
 }
 
+void AtmosphereProcess::mark_computed_fields_modified () {
+  for (auto& f : m_fields_out) {
+    f.get_header().get_tracking().mark_modified();
+  }
+  for (auto& g : m_groups_out) {
+    if (g.m_bundle) {
+      g.m_bundle->get_header().get_tracking().mark_modified();
+    } else {
+      for (auto& f : g.m_fields) {
+        f.second->get_header().get_tracking().mark_modified();
+      }
+    }
+  }
+}
+
 void AtmosphereProcess::add_me_as_provider (const Field& f) {
   f.get_header_ptr()->get_tracking().add_provider(weak_from_this());
 }
@@ -539,6 +591,12 @@ add_precondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_precondition_checks.push_back(std::make_pair(cfh,pc));
+
+  std::vector<prop_check_ptr> pcs;
+  for (const auto& it : m_precondition_checks) {
+    pcs.push_back(it.second);
+  }
+  m_fused_precondition_checks.set_checks(pcs);
 }
 
 void AtmosphereProcess::
@@ -586,6 +644,12 @@ add_postcondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_postcondition_checks.push_back(std::make_pair(cfh,pc));
+
+  std::vector<prop_check_ptr> pcs;
+  for (const auto& it : m_postcondition_checks) {
+    pcs.push_back(it.second);
+  }
+  m_fused_postcondition_checks.set_checks(pcs);
 }
 
 void AtmosphereProcess::
@@ -7,6 +7,7 @@
 #include "share/field/field_identifier.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/property_checks/property_check.hpp"
+#include "share/property_checks/fused_property_checks.hpp"
 #include "share/field/field_request.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
@@ -371,8 +372,9 @@ protected:
   // This provides access to this process's timestamp.
   const TimeStamp& timestamp() const { return m_time_stamp; }
 
-  // These three methods modify the FieldTracking of the input field (see field_tracking.hpp)
+  // These four methods modify the FieldTracking of the input field (see field_tracking.hpp)
   void update_time_stamps ();
+  void mark_computed_fields_modified ();
   void add_me_as_provider (const Field& f);
   void add_me_as_customer (const Field& f);
 
@@ -417,6 +419,9 @@ protected:
   // A prefix to add to this atm proc timer
   std::string m_timer_prefix;
 
+  // The id of the run timer (registered at the first run call)
+  int m_run_timer_id = -1;
+
   // The logger for the whole atmosphere
   // WARNING: this is non-const, but you should *NOT* modify its
   //          log level and/or its sinks. If you just need to log
@@ -467,6 +472,11 @@ private:
                            const CheckFailHandling     check_fail_handling,
                            const PropertyCheckCategory property_check_category) const;
 
+  // Run a list of property checks, using the fused checks to skip those known to pass.
+  void run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                            const FusedPropertyChecks&  fused_checks,
+                            const PropertyCheckCategory property_check_category) const;
+
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
   //       Instead, they are forced to use access function, which include
@@ -498,6 +508,10 @@ private:
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_precondition_checks;
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_postcondition_checks;
 
+  // Fused version of the pointwise checks above, to pre-screen them in few kernels
+  FusedPropertyChecks m_fused_precondition_checks;
+  FusedPropertyChecks m_fused_postcondition_checks;
+
   // Column local mass and energy conservation check
   std::pair<CheckFailHandling,prop_check_ptr> m_column_conservation_check;
 
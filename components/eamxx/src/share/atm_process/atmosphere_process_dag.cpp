@@ -343,7 +343,11 @@ add_nodes (const group_type& atm_procs)
   const int num_procs = atm_procs.get_num_processes();
   const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
 
-  EKAT_REQUIRE_MSG (sequential, "Error! Parallel splitting dag not yet supported.\n");
+  // In parallel splitting, all processes in the group see the same inputs,
+  // so their dependencies must be resolved against the providers that
+  // come *before* the group, not against the other processes in the group.
+  const auto providers_before_group = m_fid_to_last_provider;
+  const auto& input_providers = sequential ? m_fid_to_last_provider : providers_before_group;
 
   int id = m_nodes.size();
   for (int i=0; i<num_procs; ++i) {
@@ -371,8 +375,8 @@ add_nodes (const group_type& atm_procs)
         const auto& fid = f.get_header().get_identifier();
         const int fid_id = add_fid(fid);
         node.required.insert(fid_id);
-        auto it = m_fid_to_last_provider.find(fid_id);
-        if (it==m_fid_to_last_provider.end()) {
+        auto it = input_providers.find(fid_id);
+        if (it==input_providers.end()) {
           m_unmet_deps[id].insert(fid_id);
         } else {
           // Establish parent-child relationship
@@ -404,15 +408,15 @@ add_nodes (const group_type& atm_procs)
           const auto& gr_fid = group.m_bundle->get_header().get_identifier();
           const int gr_fid_id = add_fid(gr_fid);
           node.gr_required.insert(gr_fid_id);
-          auto it = m_fid_to_last_provider.find(gr_fid_id);
-          if (it==m_fid_to_last_provider.end()) {
+          auto it = input_providers.find(gr_fid_id);
+          if (it==input_providers.end()) {
             // It might still be ok, as long as there is a provider for all the fields in the group
             bool all_members_have_providers = true;
             for (auto it_f : group.m_fields) {
               const auto& fid = it_f.second->get_header().get_identifier();
               const int fid_id = add_fid(fid);
-              auto it_p = m_fid_to_last_provider.find(fid_id);
-              if (it_p==m_fid_to_last_provider.end()) {
+              auto it_p = input_providers.find(fid_id);
+              if (it_p==input_providers.end()) {
                 m_unmet_deps[id].insert(fid_id);
                 all_members_have_providers = false;
               } else {
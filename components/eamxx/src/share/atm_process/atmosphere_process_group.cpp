@@ -1,12 +1,16 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_timing.hpp"
 
 #include "share/property_checks/field_nan_check.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <exception>
 #include <memory>
+#include <set>
+#include <type_traits>
 
 namespace scream {
 
@@ -27,7 +31,6 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       m_group_schedule_type = ScheduleType::Sequential;
     } else if (m_params.get<std::string>("schedule_type") == "Parallel") {
       m_group_schedule_type = ScheduleType::Parallel;
-      ekat::error::runtime_abort("Error! Parallel schedule not yet implemented.\n");
     } else {
       ekat::error::runtime_abort("Error! Invalid 'schedule_type'. Available choices are 'Parallel' and 'Sequential'.\n");
     }
@@ -45,25 +48,10 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
   // so we don't expect users to register the APG in the factory.
   apf.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
   for (int i=0; i<m_group_size; ++i) {
-    // The comm to be passed to the processes construction is
-    //  - the same as the comm of this APG, if num_entries=1 or sched_type=Sequential
-    //  - a sub-comm of this APG's comm otherwise
+    // The comm to be passed to the processes construction is the same as
+    // the comm of this APG. In parallel schedule, all processes are run on
+    // all ranks, starting from the same input state (see run_parallel).
     ekat::Comm proc_comm = m_comm;
-    if (m_group_schedule_type==ScheduleType::Parallel) {
-      // This is what's going to happen when we implment this:
-      //  - the processes in the group are going to be run in parallel
-      //  - each rank is assigned ONE atm process
-      //  - all the atm processes not assigned to this rank will be filled with
-      //    an instance of "RemoteProcessStub" (to be implemented),
-      //    which is a do-nothing class, only responsible to keep track of dependencies
-      //  - the input parameter list should specify for each atm process the number
-      //    of mpi ranks dedicated to it. Obviously, these numbers should add up
-      //    to the size of the input communicator.
-      //  - this class is then responsible of 'combining' the results togehter,
-      //    including remapping input/output fields to/from the sub-comm
-      //    distribution.
-      ekat::error::runtime_abort("Error! Parallel schedule type not yet implemented.\n");
-    }
 
     // Check if the i-th entry is a "named" atm proc or a group defined on the fly.
     // In the first case, the i-th entry of the string list is just a string,
@@ -329,6 +317,125 @@ void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
     m_atm_logger->debug("[EAMxx::initialize::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
 #endif
   }
+
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    setup_parallel_schedule();
+  }
+}
+
+void AtmosphereProcessGroup::setup_parallel_schedule () {
+  m_parallel_split_fields.clear();
+
+  // Helper lambda, to find which of our processes are in a set of providers/customers
+  auto add_procs = [&](const FieldTracking::atm_proc_set_type& procs, std::set<int>& indices) {
+    for (const auto& it : procs) {
+      const int idx = get_process_index(it.lock().get());
+      if (idx>=0) {
+        indices.insert(idx);
+      }
+    }
+  };
+
+  // Gather all the providers/customers in this group of a field. If the field is
+  // a bundle (or is part of a bundle), procs may have registered as
+  // providers/customers of the other members of the family.
+  auto get_procs = [&](const Field& f, std::set<int>& providers, std::set<int>& customers) {
+    const auto& track = f.get_header().get_tracking();
+    add_procs(track.get_providers(),providers);
+    add_procs(track.get_customers(),customers);
+    auto parent = track.get_parent().lock();
+    if (parent) {
+      add_procs(parent->get_providers(),providers);
+      add_procs(parent->get_customers(),customers);
+    }
+    for (const auto& it : track.get_children()) {
+      auto child = it.lock();
+      add_procs(child->get_providers(),providers);
+      add_procs(child->get_customers(),customers);
+    }
+  };
+
+  // A computed field needs special treatment if either
+  //  - it is computed by more than one process, or
+  //  - it is required by a process other than its (only) provider.
+  // For such fields, all processes must see the value at the beginning
+  // of the step, and the final value combines the increments of all providers.
+  auto process_field = [&](const Field& f) {
+    for (const auto& psf : m_parallel_split_fields) {
+      if (psf.f.get_header().get_identifier()==f.get_header().get_identifier()) {
+        return;
+      }
+    }
+    std::set<int> providers, customers;
+    get_procs(f,providers,customers);
+    bool shared = providers.size()>1;
+    for (int c : customers) {
+      shared |= providers.count(c)==0;
+    }
+    if (shared && providers.size()>0) {
+      ParallelSplitField psf;
+      psf.f = f;
+      psf.f_start = f.clone();
+      psf.increment = f.clone();
+      psf.providers.assign(providers.begin(),providers.end());
+      psf.users = providers;
+      psf.users.insert(customers.begin(),customers.end());
+      m_parallel_split_fields.push_back(psf);
+    }
+  };
+
+  for (const auto& atm_proc : m_atm_processes) {
+    for (const auto& f : atm_proc->get_fields_out()) {
+      process_field(f);
+    }
+    for (const auto& g : atm_proc->get_groups_out()) {
+      if (g.m_bundle) {
+        process_field(*g.m_bundle);
+      } else {
+        for (const auto& it : g.m_fields) {
+          process_field(*it.second);
+        }
+      }
+    }
+  }
+
+  // If no field couples the processes, they can be run concurrently. We can only
+  // do that if kernels can be launched from inside an OpenMP parallel region.
+#ifdef KOKKOS_ENABLE_OPENMP
+  using ExeSpace = typename DefaultDevice::execution_space;
+  m_run_concurrently = m_parallel_split_fields.size()==0 &&
+                       std::is_same<ExeSpace,Kokkos::OpenMP>::value;
+#else
+  m_run_concurrently = false;
+#endif
+
+  m_parallel_timer_id = register_timer(m_timer_prefix + name() + "::parallel");
+
+  if (m_parallel_split_fields.size()>0) {
+    std::string names;
+    for (const auto& psf : m_parallel_split_fields) {
+      names += " " + psf.f.name();
+    }
+    m_atm_logger->info("[EAMxx] Group '" + name() + "' has fields shared across processes:" + names + ".\n"
+                       "   The processes will be run one after the other, summing their increments.");
+  } else if (not m_run_concurrently) {
+    m_atm_logger->info("[EAMxx] Group '" + name() + "' cannot launch kernels concurrently on this backend.\n"
+                       "   The processes will be run one after the other.");
+  }
+}
+
+int AtmosphereProcessGroup::get_process_index (const AtmosphereProcess* proc) const {
+  for (int i=0; i<m_group_size; ++i) {
+    const auto& atm_proc = m_atm_processes[i];
+    if (atm_proc.get()==proc) {
+      return i;
+    }
+    auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_proc);
+    if (group && group->get_process_index(proc)>=0) {
+      return i;
+    }
+  }
+  return -1;
 }
 
 void AtmosphereProcessGroup::run_impl (const double dt) {
@@ -362,8 +469,114 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   }
 }
 
-void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
-  EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
+void AtmosphereProcessGroup::run_parallel (const double dt) {
+  // Same logic as in run_sequential
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->set_update_time_stamps(do_update);
+  }
+
+  start_timer(m_parallel_timer_id);
+  if (m_parallel_split_fields.size()>0) {
+    run_parallel_split(dt);
+  } else if (m_run_concurrently) {
+    run_concurrent(dt);
+  } else {
+    // The processes are independent, so the order does not matter
+    for (auto atm_proc : m_atm_processes) {
+      atm_proc->run(dt);
+    }
+  }
+  stop_timer(m_parallel_timer_id);
+
+#ifdef SCREAM_HAS_MEMORY_USAGE
+  long long my_mem_usage = get_mem_usage(MB);
+  long long max_mem_usage;
+  m_comm.all_reduce(&my_mem_usage,&max_mem_usage,1,MPI_MAX);
+  m_atm_logger->debug("[EAMxx::run_parallel::"+name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
+#endif
+}
+
+void AtmosphereProcessGroup::run_concurrent (const double dt) {
+#ifdef KOKKOS_ENABLE_OPENMP
+  // Exceptions cannot escape an OpenMP parallel region, so store them,
+  // and rethrow the first one once all processes are done.
+  std::vector<std::exception_ptr> errors(m_group_size);
+
+  // One thread per process. Kokkos kernels launched from inside an OpenMP
+  // parallel region run on the calling thread, so the processes run side by side.
+#pragma omp parallel for num_threads(m_group_size) schedule(static,1)
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    try {
+      m_atm_processes[iproc]->run(dt);
+    } catch (...) {
+      errors[iproc] = std::current_exception();
+    }
+  }
+
+  for (const auto& e : errors) {
+    if (e) {
+      std::rethrow_exception(e);
+    }
+  }
+#else
+  (void) dt;
+  EKAT_ERROR_MSG ("Error! Concurrent run of atm processes requires the Kokkos OpenMP backend.\n");
+#endif
+}
+
+void AtmosphereProcessGroup::run_parallel_split (const double dt) {
+  // NOTE: the processes are run one after the other, since some fields are
+  //       shared across them. All processes start from the same input state,
+  //       and their increments are summed.
+  const std::string timer_name = m_timer_prefix + name() + "::parallel_split";
+
+  // Store the state at the beginning of the step, and reset the increments
+  start_timer(timer_name);
+  for (auto& psf : m_parallel_split_fields) {
+    psf.f_start.deep_copy(psf.f);
+    psf.increment.deep_copy(0);
+  }
+  Kokkos::fence();
+  stop_timer(timer_name);
+
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto atm_proc = m_atm_processes[iproc];
+
+    // If a previous process updated a shared field that this process uses,
+    // restore its initial value, so that all processes see the same input state.
+    start_timer(timer_name);
+    for (auto& psf : m_parallel_split_fields) {
+      if (psf.providers.front()<iproc && psf.users.count(iproc)==1) {
+        psf.f.deep_copy(psf.f_start);
+      }
+    }
+    Kokkos::fence();
+    stop_timer(timer_name);
+
+    atm_proc->run(dt);
+
+    // Accumulate the increment of this process: inc += (f - f_start)
+    start_timer(timer_name);
+    for (auto& psf : m_parallel_split_fields) {
+      if (ekat::contains(psf.providers,iproc)) {
+        psf.f.update(psf.f_start,-1,1);
+        psf.increment.update(psf.f,1,1);
+      }
+    }
+    Kokkos::fence();
+    stop_timer(timer_name);
+  }
+
+  // Combine the contributions of all processes: f = f_start + sum_i inc_i
+  start_timer(timer_name);
+  for (auto& psf : m_parallel_split_fields) {
+    psf.f.deep_copy(psf.f_start);
+    psf.f.update(psf.increment,1,1);
+  }
+  Kokkos::fence();
+  stop_timer(timer_name);
 }
 
 void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
@@ -381,9 +594,10 @@ void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
 void AtmosphereProcessGroup::
 set_required_field (const Field& f) {
   if (m_group_schedule_type==ScheduleType::Parallel) {
-    // In parallel splitting, all required fields are *actual* inputs,
+    // In parallel schedule, all required fields are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_field(f);
+    return;
   }
 
   // Find the first process that requires this group
@@ -449,9 +663,10 @@ endloop:
 void AtmosphereProcessGroup::
 set_required_group (const FieldGroup& group) {
   if (m_group_schedule_type==ScheduleType::Parallel) {
-    // In parallel splitting, all required group are *actual* inputs,
+    // In parallel schedule, all required group are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_group(group);
+    return;
   }
 
   // Find the first process that requires this group
@@ -9,6 +9,7 @@
 
 #include <string>
 #include <list>
+#include <set>
 
 namespace scream
 {
@@ -24,6 +25,25 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In parallel scheduling, all processes in the group see the same input
+ *  state (the one at the beginning of the group step). The FieldTracking
+ *  providers/customers are used to find the fields that couple the processes,
+ *  i.e., fields updated by more than one process, or updated by one process
+ *  and used by another one.
+ *   - If there are no such fields, the processes are independent, and are run
+ *     concurrently, one OpenMP thread per process. On this path there is no
+ *     copy of the state. With the OpenMP backend, kernels launched from inside
+ *     the parallel region run on the thread of their process. With other
+ *     backends, the processes run one after the other.
+ *   - Otherwise, the processes are run one after the other, and the coupling
+ *     fields are combined at the end of the step by summing the increments
+ *     of all their providers, i.e., x_new = x_old + sum_i (x_i - x_old).
+ *  Processes run concurrently must not perform MPI communication or IO
+ *  inside their run_impl method.
+ *  The wall time of the group step is tracked by the '<group>::parallel' timer,
+ *  and can be compared with the sum of the '<proc>::run' timers of its processes,
+ *  which is the cost of running them sequentially.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -105,7 +125,16 @@ protected:
   void finalize_impl   (/* what inputs? */);
 
   void run_sequential (const double dt);
-  void run_parallel   (const double dt);
+  void run_parallel (const double dt);
+  void run_concurrent (const double dt);
+  void run_parallel_split (const double dt);
+
+  // Sets up the data needed to run the stored processes with parallel schedule.
+  void setup_parallel_schedule ();
+
+  // Returns the index of the stored process that is (or contains) the input process,
+  // or -1 if the input process is not part of this group.
+  int get_process_index (const AtmosphereProcess* proc) const;
 
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
@@ -123,6 +152,21 @@ protected:
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
 
+  // In parallel schedule, we need to store, for each field that is "shared"
+  // across processes, the state at the beginning of the step, as well as the
+  // accumulated increments of all the processes that update it.
+  // If there are no such fields, the processes are run concurrently.
+  struct ParallelSplitField {
+    Field               f;          // The field, as stored in the FieldManager
+    Field               f_start;    // The field value at the beginning of the step
+    Field               increment;  // The accumulated increments of the providers
+    std::vector<int>    providers;  // The indices of the processes that update the field
+    std::set<int>       users;      // The indices of the processes that update or use the field
+  };
+  std::vector<ParallelSplitField>   m_parallel_split_fields;
+  bool                              m_run_concurrently = false;
+  int                               m_parallel_timer_id = -1;
+
   // This is only needed to be able to access grids objects later on
   std::shared_ptr<const GridsManager>   m_grids_mgr;
 };
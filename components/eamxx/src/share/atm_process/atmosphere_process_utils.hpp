@@ -36,7 +36,8 @@ inline std::string e2str (const AtmosphereProcessType ap_type) {
 }
 
 // This enum is mostly used by AtmosphereProcessGroup to establish whether
-// its atm procs are to be run concurrently or sequentially.
+// its atm procs are to be run sequentially, or in parallel (i.e., all
+// starting from the same input state).
 // We put the enum here so other files can easily access it.
 enum class ScheduleType {
   Sequential,
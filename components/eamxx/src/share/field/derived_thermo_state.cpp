@@ -0,0 +1,215 @@
+#include "share/field/derived_thermo_state.hpp"
+
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+#include "ekat/util/ekat_units.hpp"
+
+namespace scream
+{
+
+std::shared_ptr<DerivedThermoState> DerivedThermoState::
+get_instance (const Field& T_mid, const Field& p_mid,
+              const Field& pseudo_density, const Field& qv)
+{
+  using weak_ptr_type = std::weak_ptr<DerivedThermoState>;
+  const std::string key = "derived_thermo_state";
+
+  // The object is attached to the header of T_mid. We only store a weak_ptr,
+  // since the object stores T_mid, and we don't want circular references.
+  auto& T_header = *T_mid.get_header_ptr();
+  const auto& extra = T_header.get_extra_data();
+  if (extra.find(key)!=extra.end()) {
+    auto ptr = ekat::any_cast<weak_ptr_type>(extra.at(key)).lock();
+    // Check the state fields too, in case the header was copied (e.g., by Field::clone)
+    if (ptr && ptr->is_state(T_mid,p_mid,pseudo_density,qv)) {
+      return ptr;
+    }
+  }
+
+  std::shared_ptr<DerivedThermoState> ptr (new DerivedThermoState(T_mid,p_mid,pseudo_density,qv));
+  T_header.set_extra_data(key,weak_ptr_type(ptr));
+  return ptr;
+}
+
+DerivedThermoState::
+DerivedThermoState (const Field& T_mid, const Field& p_mid,
+                    const Field& pseudo_density, const Field& qv)
+ : m_T_mid (T_mid.get_const())
+ , m_p_mid (p_mid.get_const())
+ , m_pseudo_density (pseudo_density.get_const())
+ , m_qv (qv.get_const())
+{
+  const auto& layout = T_mid.get_header().get_identifier().get_layout();
+  for (const auto& f : {p_mid,pseudo_density,qv}) {
+    EKAT_REQUIRE_MSG (f.get_header().get_identifier().get_layout()==layout,
+        "Error! All state fields must have the same layout.\n"
+        "  - T_mid layout: " + to_string(layout) + "\n"
+        "  - " + f.name() + " layout: " + to_string(f.get_header().get_identifier().get_layout()) + "\n");
+  }
+  EKAT_REQUIRE_MSG (layout.rank()==2,
+      "Error! DerivedThermoState only supports state fields with (COL,LEV) layout.\n"
+      "  - T_mid layout: " + to_string(layout) + "\n");
+
+  m_num_cols = layout.dim(0);
+  m_num_levs = layout.dim(1);
+}
+
+bool DerivedThermoState::
+is_state (const Field& T_mid, const Field& p_mid,
+          const Field& pseudo_density, const Field& qv) const
+{
+  return m_T_mid.get_header_ptr()==T_mid.get_header_ptr() &&
+         m_p_mid.get_header_ptr()==p_mid.get_header_ptr() &&
+         m_pseudo_density.get_header_ptr()==pseudo_density.get_header_ptr() &&
+         m_qv.get_header_ptr()==qv.get_header_ptr();
+}
+
+const Field& DerivedThermoState::get_dz () {
+  return get_entry(m_dz,"dz",ekat::units::m,false,&DerivedThermoState::compute_dz);
+}
+
+const Field& DerivedThermoState::get_z_int () {
+  return get_entry(m_z_int,"z_int",ekat::units::m,true,&DerivedThermoState::compute_z_int);
+}
+
+const Field& DerivedThermoState::get_z_mid () {
+  return get_entry(m_z_mid,"z_mid",ekat::units::m,false,&DerivedThermoState::compute_z_mid);
+}
+
+const Field& DerivedThermoState::get_exner () {
+  auto nondim = ekat::units::Units::nondimensional();
+  return get_entry(m_exner,"exner",nondim,false,&DerivedThermoState::compute_exner);
+}
+
+const Field& DerivedThermoState::get_density () {
+  using namespace ekat::units;
+  return get_entry(m_density,"density",kg/(m*m*m),false,&DerivedThermoState::compute_density);
+}
+
+const Field& DerivedThermoState::
+get_entry (Entry& e, const std::string& name, const ekat::units::Units& units,
+           const bool interfaces, void (DerivedThermoState::*compute) ())
+{
+  std::lock_guard<std::recursive_mutex> lock (m_mutex);
+
+  const Field* state[4] = {&m_T_mid, &m_p_mid, &m_pseudo_density, &m_qv};
+
+  bool up_to_date = e.f.is_allocated();
+  for (int i=0; i<4; ++i) {
+    up_to_date &= e.state_modifications[i]==state[i]->get_header().get_tracking().get_num_modifications();
+  }
+  if (up_to_date) {
+    return e.f;
+  }
+
+  if (not e.f.is_allocated()) {
+    using namespace ShortFieldTagsNames;
+    const auto& T_fid = m_T_mid.get_header().get_identifier();
+    FieldLayout layout = interfaces ? FieldLayout({COL,ILEV},{m_num_cols,m_num_levs+1})
+                                    : T_fid.get_layout();
+    FieldIdentifier fid (name,layout,units,T_fid.get_grid_name());
+    e.f = Field(fid);
+    e.f.get_header().get_alloc_properties().request_allocation(Pack::n);
+    e.f.allocate_view();
+  }
+
+  (this->*compute)();
+
+  // Record the state this quantity was computed from, and stamp it with the most recent time
+  util::TimeStamp ts;
+  for (int i=0; i<4; ++i) {
+    const auto& tracking = state[i]->get_header().get_tracking();
+    e.state_modifications[i] = tracking.get_num_modifications();
+    if (not ts.is_valid() || ts<tracking.get_time_stamp()) {
+      ts = tracking.get_time_stamp();
+    }
+  }
+  if (ts.is_valid()) {
+    e.f.get_header().get_tracking().update_time_stamp(ts);
+  }
+
+  return e.f;
+}
+
+void DerivedThermoState::compute_dz ()
+{
+  const auto dz             = m_dz.f.get_view<Pack**>();
+  const auto T_mid          = m_T_mid.get_view<const Pack**>();
+  const auto p_mid          = m_p_mid.get_view<const Pack**>();
+  const auto pseudo_density = m_pseudo_density.get_view<const Pack**>();
+  const auto qv             = m_qv.get_view<const Pack**>();
+
+  const int npacks = ekat::npack<Pack>(m_num_levs);
+  Kokkos::parallel_for("DerivedThermoState::compute_dz",
+                       KT::RangePolicy(0,m_num_cols*npacks),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol  = idx / npacks;
+    const int ipack = idx % npacks;
+    dz(icol,ipack) = PF::calculate_dz(pseudo_density(icol,ipack),p_mid(icol,ipack),
+                                      T_mid(icol,ipack),qv(icol,ipack));
+  });
+}
+
+void DerivedThermoState::compute_z_int ()
+{
+  const auto dz    = get_dz().get_view<const Pack**>();
+  const auto z_int = m_z_int.f.get_view<Pack**>();
+
+  // z_int is relative to the surface
+  const Real z_surf = 0.0;
+  const int num_levs = m_num_levs;
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::
+    get_thread_range_parallel_scan_team_policy(m_num_cols,ekat::npack<Pack>(num_levs));
+  Kokkos::parallel_for("DerivedThermoState::compute_z_int",
+                       policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int icol = team.league_rank();
+    PF::calculate_z_int(team,num_levs,ekat::subview(dz,icol),z_surf,ekat::subview(z_int,icol));
+  });
+}
+
+void DerivedThermoState::compute_z_mid ()
+{
+  const auto z_int = get_z_int().get_view<const Pack**>();
+  const auto z_mid = m_z_mid.f.get_view<Pack**>();
+
+  const int num_levs = m_num_levs;
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::
+    get_default_team_policy(m_num_cols,ekat::npack<Pack>(num_levs));
+  Kokkos::parallel_for("DerivedThermoState::compute_z_mid",
+                       policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int icol = team.league_rank();
+    PF::calculate_z_mid(team,num_levs,ekat::subview(z_int,icol),ekat::subview(z_mid,icol));
+  });
+}
+
+void DerivedThermoState::compute_exner ()
+{
+  const auto exner = m_exner.f.get_view<Pack**>();
+  const auto p_mid = m_p_mid.get_view<const Pack**>();
+
+  const int npacks = ekat::npack<Pack>(m_num_levs);
+  Kokkos::parallel_for("DerivedThermoState::compute_exner",
+                       KT::RangePolicy(0,m_num_cols*npacks),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol  = idx / npacks;
+    const int ipack = idx % npacks;
+    exner(icol,ipack) = PF::exner_function(p_mid(icol,ipack));
+  });
+}
+
+void DerivedThermoState::compute_density ()
+{
+  const auto dz             = get_dz().get_view<const Pack**>();
+  const auto density        = m_density.f.get_view<Pack**>();
+  const auto pseudo_density = m_pseudo_density.get_view<const Pack**>();
+
+  const int npacks = ekat::npack<Pack>(m_num_levs);
+  Kokkos::parallel_for("DerivedThermoState::compute_density",
+                       KT::RangePolicy(0,m_num_cols*npacks),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int icol  = idx / npacks;
+    const int ipack = idx % npacks;
+    density(icol,ipack) = PF::calculate_density(pseudo_density(icol,ipack),dz(icol,ipack));
+  });
+}
+
+} // namespace scream
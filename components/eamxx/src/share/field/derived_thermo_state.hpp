@@ -0,0 +1,105 @@
+#ifndef SCREAM_DERIVED_THERMO_STATE_HPP
+#define SCREAM_DERIVED_THERMO_STATE_HPP
+
+#include "share/field/field.hpp"
+#include "share/util/scream_common_physics_functions.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_pack.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace scream
+{
+
+/*
+ * Thermodynamic quantities derived from the atmosphere state
+ *
+ * Several processes and diagnostics need dz, z_int, z_mid, exner and/or density.
+ * Computing them separately costs one full 3d kernel (and one temporary) per client.
+ * This class computes each quantity on demand, and caches it until any of the state
+ * fields it is computed from (T_mid, p_mid, pseudo_density, qv) is modified.
+ * Modifications are detected via the FieldTracking of the state fields: since all processes
+ * in a time step set the same time stamp, we check the number of modifications instead.
+ *
+ * All the clients passing the same state fields to get_instance share the same object,
+ * for as long as at least one of them holds a pointer to it.
+ *
+ * NOTE: z_int and z_mid are the heights above the surface (i.e., z_int=0 at the surface).
+ * NOTE: modifications are counted by Field::deep_copy/update, and by AtmosphereProcess for
+ *       its computed fields after every run_impl call (including each subcycle). A process
+ *       that modifies a state field via its view, and then requests a quantity in the same
+ *       run_impl call, must call FieldTracking::mark_modified on the field in between.
+ * NOTE: processes in a Parallel group may run concurrently, so accesses are serialized.
+ */
+
+class DerivedThermoState {
+public:
+  using KT   = KokkosTypes<DefaultDevice>;
+  using PF   = PhysicsFunctions<DefaultDevice>;
+  using Pack = ekat::Pack<Real,SCREAM_PACK_SIZE>;
+
+  static std::shared_ptr<DerivedThermoState>
+  get_instance (const Field& T_mid, const Field& p_mid,
+                const Field& pseudo_density, const Field& qv);
+
+  // Get the derived quantities, (re)computing them if needed.
+  // The fields have SCREAM_PACK_SIZE padding, so they can be viewed as Pack or Real.
+  const Field& get_dz ();
+  const Field& get_z_int ();
+  const Field& get_z_mid ();
+  const Field& get_exner ();
+  const Field& get_density ();
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+
+  void compute_dz ();
+  void compute_z_int ();
+  void compute_z_mid ();
+  void compute_exner ();
+  void compute_density ();
+
+protected:
+
+  DerivedThermoState (const Field& T_mid, const Field& p_mid,
+                      const Field& pseudo_density, const Field& qv);
+
+  bool is_state (const Field& T_mid, const Field& p_mid,
+                 const Field& pseudo_density, const Field& qv) const;
+
+  // A derived quantity, along with the number of modifications
+  // of each state field at the time it was computed.
+  struct Entry {
+    Field   f;
+    int     state_modifications[4] = {-1,-1,-1,-1};
+  };
+
+  // If the entry is out of date, allocate it (if needed) and call the compute method
+  const Field& get_entry (Entry& e, const std::string& name, const ekat::units::Units& units,
+                          const bool interfaces, void (DerivedThermoState::*compute) ());
+
+  Field   m_T_mid;
+  Field   m_p_mid;
+  Field   m_pseudo_density;
+  Field   m_qv;
+
+  int     m_num_cols;
+  int     m_num_levs;
+
+  Entry   m_dz;
+  Entry   m_z_int;
+  Entry   m_z_mid;
+  Entry   m_exner;
+  Entry   m_density;
+
+  // Recursive, since some quantities are computed from others (e.g., z_int from dz)
+  std::recursive_mutex  m_mutex;
+};
+
+} // namespace scream
+
+#endif // SCREAM_DERIVED_THERMO_STATE_HPP
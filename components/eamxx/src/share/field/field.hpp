@@ -184,6 +184,12 @@ public:
   template<HostOrDevice HD = Device>
   void deep_copy (const Field& field_src);
 
+  // Updates this field y as y = beta*y + alpha*x
+  // NOTE: padding entries (if any) are updated too, so x and y must
+  //       have the same allocation properties along the last dimension.
+  template<HostOrDevice HD = Device, typename ST>
+  void update (const Field& x, const ST alpha, const ST beta);
+
   // Returns a subview of this field, slicing at entry k along dimension idim
   // NOTES:
   //   - the output field stores *the same* 1d view as this field. In order
@@ -240,6 +246,9 @@ protected:
   template<typename ST, HostOrDevice HD = Device>
   void deep_copy_impl (const Field& field_src);
 
+  template<HostOrDevice HD, typename ST>
+  void update_impl (const Field& x, const ST alpha, const ST beta);
+
   template<HostOrDevice HD>
   const get_view_type<char*,HD>&
   get_view_impl () const {
@@ -370,6 +379,7 @@ deep_copy (const Field& field_src) {
     default:
       EKAT_ERROR_MSG ("Error! Unrecognized field data type in Field::deep_copy.\n");
   }
+  get_header().get_tracking().mark_modified();
 }
 
 template<typename ST, HostOrDevice HD>
@@ -404,6 +414,7 @@ deep_copy (const ST value) {
     default:
       EKAT_ERROR_MSG ("Error! Unrecognized field data type in Field::deep_copy.\n");
   }
+  get_header().get_tracking().mark_modified();
 }
 
 template<typename ST, HostOrDevice HD>
@@ -510,6 +521,100 @@ void Field::deep_copy_impl (const ST value) {
   }
 }
 
+template<HostOrDevice HD, typename ST>
+void Field::
+update (const Field& x, const ST alpha, const ST beta) {
+  EKAT_REQUIRE_MSG (not m_is_read_only,
+      "Error! Cannot call update on read-only fields.\n");
+
+  EKAT_REQUIRE_MSG (data_type()==x.data_type(),
+      "Error! Cannot update a field with a field of different data type.\n");
+
+  switch (data_type()) {
+    case DataType::IntType:
+      update_impl<HD,int>(x,alpha,beta);
+      break;
+    case DataType::FloatType:
+      update_impl<HD,float>(x,alpha,beta);
+      break;
+    case DataType::DoubleType:
+      update_impl<HD,double>(x,alpha,beta);
+      break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unrecognized field data type in Field::update.\n");
+  }
+  get_header().get_tracking().mark_modified();
+}
+
+template<HostOrDevice HD, typename ST>
+void Field::
+update_impl (const Field& x, const ST alpha, const ST beta) {
+  using exec_space = typename get_device<HD>::execution_space;
+
+  const auto& layout   = get_header().get_identifier().get_layout();
+  const auto& layout_x = x.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG(layout==layout_x,
+       "ERROR: Unable to update field " + name() + " with field " + x.name() + ". Layouts don't match.\n");
+
+  // Note: as in deep_copy_impl, we need the reshaped views, since
+  //       either field might be a subfield of another one.
+  switch (layout.rank()) {
+    case 1:
+      {
+        auto y  = get_view<ST*,HD>();
+        auto xv = x.get_view<const ST*,HD>();
+        Kokkos::RangePolicy<exec_space> p(0,y.extent(0));
+        Kokkos::parallel_for(p,KOKKOS_LAMBDA(const int i) {
+          y(i) = beta*y(i) + alpha*xv(i);
+        });
+      }
+      break;
+    case 2:
+      {
+        auto y  = get_view<ST**,HD>();
+        auto xv = x.get_view<const ST**,HD>();
+        Kokkos::MDRangePolicy<exec_space,Kokkos::Rank<2>> p({0,0},{y.extent(0),y.extent(1)});
+        Kokkos::parallel_for(p,KOKKOS_LAMBDA(const int i, const int j) {
+          y(i,j) = beta*y(i,j) + alpha*xv(i,j);
+        });
+      }
+      break;
+    case 3:
+      {
+        auto y  = get_view<ST***,HD>();
+        auto xv = x.get_view<const ST***,HD>();
+        Kokkos::MDRangePolicy<exec_space,Kokkos::Rank<3>> p({0,0,0},{y.extent(0),y.extent(1),y.extent(2)});
+        Kokkos::parallel_for(p,KOKKOS_LAMBDA(const int i, const int j, const int k) {
+          y(i,j,k) = beta*y(i,j,k) + alpha*xv(i,j,k);
+        });
+      }
+      break;
+    case 4:
+      {
+        auto y  = get_view<ST****,HD>();
+        auto xv = x.get_view<const ST****,HD>();
+        Kokkos::MDRangePolicy<exec_space,Kokkos::Rank<4>> p({0,0,0,0},{y.extent(0),y.extent(1),y.extent(2),y.extent(3)});
+        Kokkos::parallel_for(p,KOKKOS_LAMBDA(const int i, const int j, const int k, const int l) {
+          y(i,j,k,l) = beta*y(i,j,k,l) + alpha*xv(i,j,k,l);
+        });
+      }
+      break;
+    case 5:
+      {
+        auto y  = get_view<ST*****,HD>();
+        auto xv = x.get_view<const ST*****,HD>();
+        Kokkos::MDRangePolicy<exec_space,Kokkos::Rank<5>> p({0,0,0,0,0},{y.extent(0),y.extent(1),y.extent(2),y.extent(3),y.extent(4)});
+        Kokkos::parallel_for(p,KOKKOS_LAMBDA(const int i, const int j, const int k, const int l, const int m) {
+          y(i,j,k,l,m) = beta*y(i,j,k,l,m) + alpha*xv(i,j,k,l,m);
+        });
+      }
+      break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported field rank in 'update'.\n");
+  }
+  Kokkos::fence();
+}
+
 template<HostOrDevice HD,typename T,int N>
 auto Field::get_ND_view () const ->
   if_t<(N<MaxRank),get_view_type<data_nd_t<T,N>,HD>>
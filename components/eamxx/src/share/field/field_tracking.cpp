@@ -22,6 +22,7 @@ void FieldTracking::update_time_stamp (const TimeStamp& ts) {
       "Error! Input time stamp is in the past.\n");
 
   m_time_stamp = ts;
+  ++m_num_modifications;
 
   // If you update a field, all its subviews will automatically be updated
   for (auto it : this->get_children()) {
@@ -31,4 +32,21 @@ void FieldTracking::update_time_stamp (const TimeStamp& ts) {
   }
 }
 
+void FieldTracking::mark_modified () {
+  ++m_num_modifications;
+
+  // Subviews share the data, so they are modified too
+  for (auto it : this->get_children()) {
+    auto c = it.lock();
+    EKAT_REQUIRE_MSG(c, "Error! A weak pointer of a child field expired.\n");
+    c->mark_modified();
+  }
+
+  // And so is the field we are a subview of (but not our siblings).
+  // NOTE: this may mark an ancestor more than once, but only changes in the count matter.
+  for (auto p = get_parent().lock(); p!=nullptr; p = p->get_parent().lock()) {
+    ++p->m_num_modifications;
+  }
+}
+
 } // namespace scream
@@ -39,6 +39,11 @@ public:
   // Please, notice this is not the OS time stamp (see time_stamp.hpp for details).
   const TimeStamp& get_time_stamp () const { return m_time_stamp; }
 
+  // The number of times the field was modified. All the processes running in a time step set
+  // the same time stamp (and subcycled processes set it only once), so this can be used to
+  // tell if a field changed within a time step. See mark_modified for what counts as a change.
+  int get_num_modifications () const { return m_num_modifications; }
+
   //  - provider: can compute the field as an output
   //  - customer: requires the field as an input
   const atm_proc_set_type& get_providers () const { return m_providers; }
@@ -61,6 +66,13 @@ public:
   //       However, if the field has a 'parent' (see FamilyTracking), the parent's ts will not be updated.
   void update_time_stamp (const TimeStamp& ts);
 
+  // Record that the field data was modified. This is done by Field's deep_copy/update methods,
+  // by update_time_stamp, and by AtmosphereProcess for all its computed fields after every
+  // run_impl call (i.e., at every subcycle). Code modifying the data via views in other
+  // contexts should call this too.
+  // NOTE: since they share the data, children and parent (see FamilyTracking) are marked too.
+  void mark_modified ();
+
 protected:
 
   // We keep the field name just to make debugging messages more helpful
@@ -68,6 +80,7 @@ protected:
 
   // Tracking the updates of the field
   TimeStamp         m_time_stamp;
+  int               m_num_modifications = 0;
 
   // List of provider/customer processes. A provider is an atm process that computes/updates the field.
   // A customer is an atm process that uses the field just as an input.
@@ -104,6 +104,28 @@ ST field_min(const Field& f, const ekat::Comm* comm = nullptr)
   return impl::field_min<ST>(f,comm);
 }
 
+// Computes sum, max, min, and frobenius norm of several fields at once.
+// Each field is traversed only once (on device), and all the global
+// reductions are done with a single MPI call.
+template<typename ST>
+std::vector<FieldStats<ST>>
+field_stats(const std::vector<Field>& fields, const ekat::Comm* comm = nullptr)
+{
+  for (const auto& f : fields) {
+    // Check compatibility between ST and field data type
+    const auto data_type = f.data_type();
+
+    EKAT_REQUIRE_MSG (
+        (std::is_same<ST,int>::value && data_type==DataType::IntType) ||
+        (std::is_same<ST,float>::value && data_type==DataType::FloatType) ||
+        (std::is_same<ST,double>::value && data_type==DataType::DoubleType),
+        "Error! Field data type incompatible with template argument.\n"
+        "  - field name: " + f.name() + "\n");
+  }
+
+  return impl::field_stats<ST>(fields,comm);
+}
+
 // Prints the value of a field at a certain location, specified by tags and indices.
 // If the field layout contains all the location tags, we will slice the field along
 // those tags, and print it. E.g., f might be a <COL,LEV> field, and the tags/indices
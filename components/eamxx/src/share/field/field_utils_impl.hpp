@@ -5,11 +5,23 @@
 
 #include "ekat/mpi/ekat_comm.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 namespace scream {
 
+// Global statistics of a field, as computed by field_stats.
+// NOTE: frobenius_norm is only computed for floating point fields (0 otherwise).
+template<typename ST>
+struct FieldStats {
+  ST sum;
+  ST max;
+  ST min;
+  ST frobenius_norm;
+};
+
 // Check that two fields store the same entries.
 // NOTE: if the field is padded, padding entries are NOT checked.
 namespace impl {
@@ -208,103 +220,211 @@ void randomize (const Field& f, Engine& engine, PDF&& pdf)
   f.sync_to_dev();
 }
 
+// Adds x to the running sum, accumulating the rounding error in c
+// (Kahan-Babuska-Neumaier algorithm). The compensated result is sum+c.
 template<typename ST>
-ST frobenius_norm(const Field& f, const ekat::Comm* comm)
+KOKKOS_INLINE_FUNCTION
+void compensated_add (ST& sum, ST& c, const ST x)
 {
+  const ST t = sum + x;
+  if ((sum>=0 ? sum : -sum) >= (x>=0 ? x : -x)) {
+    c += (sum - t) + x;
+  } else {
+    c += (x - t) + sum;
+  }
+  sum = t;
+}
+
+// Gives access to the entries of a field view through a flattened index over
+// the *layout* dims, so that padding entries (if any) are skipped.
+template<typename ViewT>
+struct FlatFieldView {
+  using ST = typename ViewT::non_const_value_type;
+
+  ViewT v;
+  Kokkos::Array<int,Field::MaxRank> dims;
+
+  KOKKOS_INLINE_FUNCTION
+  ST entry (const int idx) const {
+    // Unflatten idx, using the layout dims. Indices past the view rank stay 0.
+    int ijk[Field::MaxRank] = {0,0,0,0,0,0};
+    for (int d=static_cast<int>(ViewT::rank)-1, tmp=idx; d>=0; --d) {
+      ijk[d] = tmp % dims[d];
+      tmp /= dims[d];
+    }
+    return v.access(ijk[0],ijk[1],ijk[2],ijk[3],ijk[4],ijk[5]);
+  }
+};
+
+// Compensated sum of the entries (or of their squares) of a field
+template<typename ST>
+struct FieldSumValue {
+  ST sum, c;
+};
+
+template<typename ViewT, bool Squared>
+struct FieldSumFunctor : public FlatFieldView<ViewT> {
+  using ST         = typename FlatFieldView<ViewT>::ST;
+  using value_type = FieldSumValue<ST>;
+
+  KOKKOS_INLINE_FUNCTION
+  void init (value_type& val) const {
+    val.sum = val.c = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join (value_type& dst, const value_type& src) const {
+    compensated_add(dst.sum,dst.c,src.sum);
+    dst.c += src.c;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int idx, value_type& val) const {
+    const ST x = this->entry(idx);
+    compensated_add(val.sum,val.c,Squared ? x*x : x);
+  }
+};
+
+template<typename ViewT>
+using FieldSumOp = FieldSumFunctor<ViewT,false>;
+template<typename ViewT>
+using FieldSumSqOp = FieldSumFunctor<ViewT,true>;
+
+// Max (or min) of the entries of a field
+template<typename ViewT, bool Max>
+struct FieldExtremumFunctor : public FlatFieldView<ViewT> {
+  using ST         = typename FlatFieldView<ViewT>::ST;
+  using value_type = ST;
+
+  KOKKOS_INLINE_FUNCTION
+  void init (value_type& val) const {
+    val = Max ? Kokkos::reduction_identity<ST>::max()
+              : Kokkos::reduction_identity<ST>::min();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join (value_type& dst, const value_type& src) const {
+    dst = (Max ? src>dst : src<dst) ? src : dst;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int idx, value_type& val) const {
+    const ST x = this->entry(idx);
+    val = (Max ? x>val : x<val) ? x : val;
+  }
+};
+
+template<typename ViewT>
+using FieldMaxOp = FieldExtremumFunctor<ViewT,true>;
+template<typename ViewT>
+using FieldMinOp = FieldExtremumFunctor<ViewT,false>;
+
+// The local (i.e., on this rank) statistics of a field.
+// NOTE: the sum of squares is only computed for floating point types.
+template<typename ST>
+struct FieldStatsValue {
+  ST sum, sum_c;
+  ST sumsq, sumsq_c;
+  ST max, min;
+};
+
+// Computes all the local statistics of a field with a single parallel_reduce.
+// Only use this if several statistics are needed: for a single one, the
+// functors above are cheaper.
+template<typename ViewT>
+struct FieldStatsFunctor : public FlatFieldView<ViewT> {
+  using ST         = typename FlatFieldView<ViewT>::ST;
+  using value_type = FieldStatsValue<ST>;
+
+  KOKKOS_INLINE_FUNCTION
+  void init (value_type& val) const {
+    val.sum = val.sum_c = 0;
+    val.sumsq = val.sumsq_c = 0;
+    val.max = Kokkos::reduction_identity<ST>::max();
+    val.min = Kokkos::reduction_identity<ST>::min();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join (value_type& dst, const value_type& src) const {
+    compensated_add(dst.sum,dst.sum_c,src.sum);
+    dst.sum_c += src.sum_c;
+    compensated_add(dst.sumsq,dst.sumsq_c,src.sumsq);
+    dst.sumsq_c += src.sumsq_c;
+    dst.max = src.max>dst.max ? src.max : dst.max;
+    dst.min = src.min<dst.min ? src.min : dst.min;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int idx, value_type& val) const {
+    const ST x = this->entry(idx);
+
+    compensated_add(val.sum,val.sum_c,x);
+    if (std::is_floating_point<ST>::value) {
+      compensated_add(val.sumsq,val.sumsq_c,x*x);
+    }
+    val.max = x>val.max ? x : val.max;
+    val.min = x<val.min ? x : val.min;
+  }
+};
+
+// Runs the reduction functor Op over all the (non-padding) entries of a field
+template<template<typename> class Op, typename ST, int N>
+typename Op<Field::get_view_type<Field::data_nd_t<const ST,N>,Device>>::value_type
+local_field_reduction_nd (const Field& f)
+{
+  using exec_space = typename Field::get_device<Device>::execution_space;
+  using view_t     = Field::get_view_type<Field::data_nd_t<const ST,N>,Device>;
+
   const auto& fl = f.get_header().get_identifier().get_layout();
 
-  // TODO: compute directly on device
-  f.sync_to_host();
+  Op<view_t> func;
+  func.v = f.template get_view<Field::data_nd_t<const ST,N>>();
+  for (int d=0; d<Field::MaxRank; ++d) {
+    func.dims[d] = d<N ? fl.dim(d) : 1;
+  }
+
+  typename Op<view_t>::value_type result;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<exec_space>(0,fl.size()),func,result);
+  return result;
+}
 
-  // Note: use Kahan algorithm to increase accuracy
-  ST norm = 0;
-  ST c = 0;
-  ST temp,y;
+template<template<typename> class Op, typename ST>
+typename Op<Field::get_view_type<Field::data_nd_t<const ST,1>,Device>>::value_type
+local_field_reduction (const Field& f)
+{
+  const auto& fl = f.get_header().get_identifier().get_layout();
   switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_view<ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          y = std::pow(v(i),2) - c;
-          temp = norm + y;
-          c = (temp - norm) - y;
-          norm = temp;
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_view<ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            y = std::pow(v(i,j),2) - c;
-            temp = norm + y;
-            c = (temp - norm) - y;
-            norm = temp;
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_view<ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              y = std::pow(v(i,j,k),2) - c;
-              temp = norm + y;
-              c = (temp - norm) - y;
-              norm = temp;
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_view<ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                y = std::pow(v(i,j,k,l),2) - c;
-                temp = norm + y;
-                c = (temp - norm) - y;
-                norm = temp;
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_view<ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  y = std::pow(v(i,j,k,l,m),2) - c;
-                  temp = norm + y;
-                  c = (temp - norm) - y;
-                  norm = temp;
-        }}}}}
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_view<ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    y = std::pow(v(i,j,k,l,m,n),2) - c;
-                    temp = norm + y;
-                    c = (temp - norm) - y;
-                    norm = temp;
-        }}}}}}
-      }
-      break;
+    case 1: return local_field_reduction_nd<Op,ST,1>(f);
+    case 2: return local_field_reduction_nd<Op,ST,2>(f);
+    case 3: return local_field_reduction_nd<Op,ST,3>(f);
+    case 4: return local_field_reduction_nd<Op,ST,4>(f);
+    case 5: return local_field_reduction_nd<Op,ST,5>(f);
+    case 6: return local_field_reduction_nd<Op,ST,6>(f);
     default:
       EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
   }
+  return {};
+}
+
+// MPI reduction op for the (sum, sumsq, max, min) tuples packed by field_stats
+template<typename ST>
+void field_stats_mpi_op (void* in, void* inout, int* len, MPI_Datatype* /* dtype */)
+{
+  const ST* src = reinterpret_cast<const ST*>(in);
+  ST* dst = reinterpret_cast<ST*>(inout);
+  for (int i=0; i<*len; ++i, src+=4, dst+=4) {
+    dst[0] += src[0];
+    dst[1] += src[1];
+    dst[2] = std::max(dst[2],src[2]);
+    dst[3] = std::min(dst[3],src[3]);
+  }
+}
+
+template<typename ST>
+ST frobenius_norm(const Field& f, const ekat::Comm* comm)
+{
+  const auto sumsq = local_field_reduction<FieldSumSqOp,ST>(f);
+  ST norm = sumsq.sum + sumsq.c;
 
   if (comm) {
     ST global_norm;
@@ -318,100 +438,8 @@ ST frobenius_norm(const Field& f, const ekat::Comm* comm)
 template<typename ST>
 ST field_sum(const Field& f, const ekat::Comm* comm)
 {
-  const auto& fl = f.get_header().get_identifier().get_layout();
-
-  // TODO: compute directly on device
-  f.sync_to_host();
-
-  // Note: use Kahan algorithm to increase accuracy
-  ST sum = 0;
-  ST c = 0;
-  ST temp,y;
-  switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_view<ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          y = v(i) - c;
-          temp = sum + y;
-          c = (temp - sum) - y;
-          sum = temp;
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_view<ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            y = v(i,j) - c;
-            temp = sum + y;
-            c = (temp - sum) - y;
-            sum = temp;
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_view<ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              y = v(i,j,k) - c;
-              temp = sum + y;
-              c = (temp - sum) - y;
-              sum = temp;
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_view<ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                y = v(i,j,k,l) - c;
-                temp = sum + y;
-                c = (temp - sum) - y;
-                sum = temp;
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_view<ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  y = v(i,j,k,l,m) - c;
-                  temp = sum + y;
-                  c = (temp - sum) - y;
-                  sum = temp;
-        }}}}}
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_view<ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    y = v(i,j,k,l,m,n) - c;
-                    temp = sum + y;
-                    c = (temp - sum) - y;
-                    sum = temp;
-        }}}}}}
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
-  }
+  const auto local_sum = local_field_reduction<FieldSumOp,ST>(f);
+  ST sum = local_sum.sum + local_sum.c;
 
   if (comm) {
     ST global_sum;
@@ -425,79 +453,7 @@ ST field_sum(const Field& f, const ekat::Comm* comm)
 template<typename ST>
 ST field_max(const Field& f, const ekat::Comm* comm)
 {
-  const auto& fl = f.get_header().get_identifier().get_layout();
-
-  // TODO: compute directly on device
-  f.sync_to_host();
-
-  ST max = std::numeric_limits<ST>::lowest();
-  switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_view<ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          max = std::max(max,v(i));
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_view<ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            max = std::max(max,v(i,j));
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_view<ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              max = std::max(max,v(i,j,k));
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_view<ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                max = std::max(max,v(i,j,k,l));
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_view<ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  max = std::max(max,v(i,j,k,l,m));
-        }}}}}
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_view<ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    max = std::max(max,v(i,j,k,l,m,n));
-        }}}}}}
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
-  }
+  ST max = local_field_reduction<FieldMaxOp,ST>(f);
 
   if (comm) {
     ST global_max;
@@ -511,79 +467,7 @@ ST field_max(const Field& f, const ekat::Comm* comm)
 template<typename ST>
 ST field_min(const Field& f, const ekat::Comm* comm)
 {
-  const auto& fl = f.get_header().get_identifier().get_layout();
-
-  // TODO: compute directly on device
-  f.sync_to_host();
-
-  ST min = std::numeric_limits<ST>::max();
-  switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_view<ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          min = std::min(min,v(i));
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_view<ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            min = std::min(min,v(i,j));
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_view<ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              min = std::min(min,v(i,j,k));
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_view<ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                min = std::min(min,v(i,j,k,l));
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_view<ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  min = std::min(min,v(i,j,k,l,m));
-        }}}}}
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_view<ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    min = std::min(min,v(i,j,k,l,m,n));
-        }}}}}}
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
-  }
+  ST min = local_field_reduction<FieldMinOp,ST>(f);
 
   if (comm) {
     ST global_min;
@@ -594,6 +478,49 @@ ST field_min(const Field& f, const ekat::Comm* comm)
   }
 }
 
+template<typename ST>
+std::vector<FieldStats<ST>>
+field_stats (const std::vector<Field>& fields, const ekat::Comm* comm)
+{
+  // Pack the local stats of all fields as (sum, sumsq, max, min) tuples
+  const int nfields = fields.size();
+  std::vector<ST> local(4*nfields), global;
+  for (int i=0; i<nfields; ++i) {
+    const auto stats = local_field_reduction<FieldStatsFunctor,ST>(fields[i]);
+    local[4*i+0] = stats.sum + stats.sum_c;
+    local[4*i+1] = stats.sumsq + stats.sumsq_c;
+    local[4*i+2] = stats.max;
+    local[4*i+3] = stats.min;
+  }
+
+  if (comm) {
+    // Reduce all the tuples with a single MPI call. Since the tuples mix sum and
+    // max/min reductions, we need a custom datatype and op.
+    MPI_Datatype tuple_t;
+    MPI_Op op;
+    MPI_Type_contiguous(4,ekat::get_mpi_type<ST>(),&tuple_t);
+    MPI_Type_commit(&tuple_t);
+    MPI_Op_create(&field_stats_mpi_op<ST>,1,&op);
+
+    global.resize(4*nfields);
+    MPI_Allreduce(local.data(),global.data(),nfields,tuple_t,op,comm->mpi_comm());
+
+    MPI_Op_free(&op);
+    MPI_Type_free(&tuple_t);
+  } else {
+    global = std::move(local);
+  }
+
+  std::vector<FieldStats<ST>> stats(nfields);
+  for (int i=0; i<nfields; ++i) {
+    stats[i].sum = global[4*i+0];
+    stats[i].frobenius_norm = std::is_floating_point<ST>::value ? std::sqrt(global[4*i+1]) : 0;
+    stats[i].max = global[4*i+2];
+    stats[i].min = global[4*i+3];
+  }
+  return stats;
+}
+
 template<typename T>
 void print_field_hyperslab (const Field& f,
                             std::vector<FieldTag> tags,
@@ -1,6 +1,8 @@
 #include "share/grid/remap/horizontal_remap_utility.hpp"
 #include "share/util/scream_timing.hpp"
 
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
 namespace scream {
 
 /*-----------------------------------------------------------------------------------------------*/
@@ -333,9 +335,49 @@ void HorizontalMap::set_unique_source_dofs()
     // Sync to Host
     seg.sync_to_host();
   }
+  // Now that all segments know their target and source indices, flatten them
+  // into the CRS matrix used by apply_remap.
+  build_crs_matrix();
   stop_timer("EAMxx::HorizontalMap::set_unique_dofs");
 }
 /*-----------------------------------------------------------------------------------------------*/
+// This function flattens the set of remap segments into a CRS sparse matrix, with one row for each
+// local target dof.  Rows with no segment are left empty, so that the remapped value is zero.
+// The matrix is built on HOST, since this is only done once per map, and then copied to device.
+void HorizontalMap::build_crs_matrix()
+{
+  EKAT_REQUIRE_MSG(m_unique_set,"Error in HorizontalMap " + m_name + " - build_crs_matrix called before set_unique_source_dofs.");
+  m_row_offsets = view_1d<int>("",m_num_dofs+1);
+  auto row_offsets_h = Kokkos::create_mirror_view(m_row_offsets);
+  Kokkos::deep_copy(row_offsets_h,0);
+  // First pass: count the number of entries in each row
+  for (const auto& seg : m_map_segments) {
+    row_offsets_h(seg.get_dof_idx()+1) += seg.get_length();
+  }
+  for (int ii=0; ii<m_num_dofs; ii++) {
+    row_offsets_h(ii+1) += row_offsets_h(ii);
+  }
+  const int nnz = row_offsets_h(m_num_dofs);
+  // Second pass: fill the column indices and weights
+  m_col_idx     = view_1d<int>("",nnz);
+  m_crs_weights = view_1d<Real>("",nnz);
+  auto col_idx_h = Kokkos::create_mirror_view(m_col_idx);
+  auto weights_h = Kokkos::create_mirror_view(m_crs_weights);
+  for (const auto& seg : m_map_segments) {
+    const int start = row_offsets_h(seg.get_dof_idx());
+    const auto seg_src_idx_h = seg.get_source_idx_on_host();
+    const auto seg_weights_h = seg.get_weights_on_host();
+    for (int ii=0; ii<seg.get_length(); ii++) {
+      col_idx_h(start+ii) = seg_src_idx_h(ii);
+      weights_h(start+ii) = seg_weights_h(ii);
+    }
+  }
+  Kokkos::deep_copy(m_row_offsets,row_offsets_h);
+  Kokkos::deep_copy(m_col_idx,col_idx_h);
+  Kokkos::deep_copy(m_crs_weights,weights_h);
+  m_crs_set = true;
+}
+/*-----------------------------------------------------------------------------------------------*/
 /*-----------------------------------------------------------------------------------------------*/
 void HorizontalMap::check() const
 {
@@ -383,23 +425,20 @@ void HorizontalMap::print() const
 // a horizontal slice of remapped data.  The assumption is that there are no levels in this data.
 void HorizontalMap::apply_remap(const view_1d<const Real>& source_data, const view_1d<Real>& remapped_data) {
   start_timer("EAMxx::HorizontalMap::apply_remap_1d");
-  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      int idx = source_idx_h(ii);
-      remapped_data_h(seg_dof_idx) += source_data_h(idx)*weights_h(ii);
-    }
+  if (m_num_dofs>0) {
+    EKAT_REQUIRE_MSG(m_crs_set,"Error in HorizontalMap " + m_name + " - apply_remap called before set_unique_source_dofs.");
+    const auto row_offsets = m_row_offsets;
+    const auto col_idx     = m_col_idx;
+    const auto weights     = m_crs_weights;
+    Kokkos::parallel_for("HorizontalMap::apply_remap_1d", m_num_dofs, KOKKOS_LAMBDA (const int& ii) {
+      Real val = 0;
+      for (int jj=row_offsets(ii); jj<row_offsets(ii+1); ++jj) {
+        val += source_data(col_idx(jj))*weights(jj);
+      }
+      remapped_data(ii) = val;
+    });
+    Kokkos::fence();
   }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
   stop_timer("EAMxx::HorizontalMap::apply_remap_1d");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -407,27 +446,32 @@ void HorizontalMap::apply_remap(const view_1d<const Real>& source_data, const vi
 // a set horizontal slices of remapped data.  The assumption is that the second dimension is number
 // of levels
 void HorizontalMap::apply_remap(const view_2d<const Real>& source_data, const view_2d<Real>& remapped_data) {
+  using ExeSpaceUtils = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using MemberType    = typename KT::MemberType;
+
   start_timer("EAMxx::HorizontalMap::apply_remap_2d");
-  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  int num_levs = source_data.extent(1);
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      for (int kk=0; kk<num_levs; kk++) {
-        int idx = source_idx_h(ii);
-        remapped_data_h(seg_dof_idx,kk) += source_data_h(idx,kk)*weights_h(ii);
-      }
-    }
+  if (m_num_dofs>0) {
+    EKAT_REQUIRE_MSG(m_crs_set,"Error in HorizontalMap " + m_name + " - apply_remap called before set_unique_source_dofs.");
+    const int num_levs = source_data.extent(1);
+    const auto row_offsets = m_row_offsets;
+    const auto col_idx     = m_col_idx;
+    const auto weights     = m_crs_weights;
+    // One team per target column, threads over levels
+    const auto policy = ExeSpaceUtils::get_default_team_policy(m_num_dofs, num_levs);
+    Kokkos::parallel_for("HorizontalMap::apply_remap_2d", policy, KOKKOS_LAMBDA (const MemberType& team) {
+      const int ii  = team.league_rank();
+      const int beg = row_offsets(ii);
+      const int end = row_offsets(ii+1);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,num_levs), [&](const int kk) {
+        Real val = 0;
+        for (int jj=beg; jj<end; ++jj) {
+          val += source_data(col_idx(jj),kk)*weights(jj);
+        }
+        remapped_data(ii,kk) = val;
+      });
+    });
+    Kokkos::fence();
   }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
   stop_timer("EAMxx::HorizontalMap::apply_remap_2d");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -435,30 +479,36 @@ void HorizontalMap::apply_remap(const view_2d<const Real>& source_data, const vi
 // a set of horizontal slices of remapped data.  The assumption is that there are levels and one other
 // dimension for this data.
 void HorizontalMap::apply_remap(const view_3d<const Real>& source_data, const view_3d<Real>& remapped_data) {
+  using ExeSpaceUtils = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using MemberType    = typename KT::MemberType;
+
   start_timer("EAMxx::HorizontalMap::apply_remap_3d");
-  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  int num_levs = source_data.extent(2);
-  int num_bands = source_data.extent(1);
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      for (int nn=0; nn<num_bands; nn++) {
-        for (int kk=0; kk<num_levs; kk++) {
-          int idx = source_idx_h(ii);
-          remapped_data_h(seg_dof_idx,nn,kk) += source_data_h(idx,nn,kk)*weights_h(ii);
+  if (m_num_dofs>0) {
+    EKAT_REQUIRE_MSG(m_crs_set,"Error in HorizontalMap " + m_name + " - apply_remap called before set_unique_source_dofs.");
+    const int num_bands = source_data.extent(1);
+    const int num_levs  = source_data.extent(2);
+    const int num_inner = num_bands*num_levs;
+    const auto row_offsets = m_row_offsets;
+    const auto col_idx     = m_col_idx;
+    const auto weights     = m_crs_weights;
+    // One team per target column, threads over the flattened (band,lev) index
+    const auto policy = ExeSpaceUtils::get_default_team_policy(m_num_dofs, num_inner);
+    Kokkos::parallel_for("HorizontalMap::apply_remap_3d", policy, KOKKOS_LAMBDA (const MemberType& team) {
+      const int ii  = team.league_rank();
+      const int beg = row_offsets(ii);
+      const int end = row_offsets(ii+1);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,num_inner), [&](const int idx) {
+        const int nn = idx / num_levs;
+        const int kk = idx % num_levs;
+        Real val = 0;
+        for (int jj=beg; jj<end; ++jj) {
+          val += source_data(col_idx(jj),nn,kk)*weights(jj);
         }
-      }
-    }
+        remapped_data(ii,nn,kk) = val;
+      });
+    });
+    Kokkos::fence();
   }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
   stop_timer("EAMxx::HorizontalMap::apply_remap_3d");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -84,6 +84,9 @@ private:
  *   N:          Is the total number of source columns mapping to the target column (N>=1)
  *
  * This structure follows the format used by the component coupler.
+ *
+ * Once the unique source dofs are set, the segments are flattened into a CRS sparse matrix
+ * (one row per local target dof) stored on device, which is what apply_remap uses.
  * --------------------------------------
  *  A.S. Donahue (LLNL): 2022-09-07
  *===============================================================================================*/
@@ -136,6 +139,9 @@ public:
   
 private:
 
+  // Flatten the remap segments into the CRS matrix used by apply_remap
+  void build_crs_matrix();
+
   // Global degrees of freedom information on target grid
   view_1d<gid_type> m_dofs_gids;
   int               m_num_dofs = 0;
@@ -149,6 +155,13 @@ private:
   bool                   m_dofs_set = false;
   std::vector<HorizontalMapSegment> m_map_segments;
   int                    m_num_segments = 0;
+  // CRS representation of the map: row ii (a local target dof) has entries
+  // [m_row_offsets(ii),m_row_offsets(ii+1)) in m_col_idx and m_crs_weights,
+  // where m_col_idx is the index of the source dof in m_unique_dofs.
+  view_1d<int>           m_row_offsets;
+  view_1d<int>           m_col_idx;
+  view_1d<Real>          m_crs_weights;
+  bool                   m_crs_set = false;
 
 }; // struct HorizontalMap
 
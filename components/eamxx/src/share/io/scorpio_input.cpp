@@ -2,6 +2,7 @@
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/io/scream_io_worker.hpp"
 
 #include <memory>
 #include <numeric>
@@ -240,11 +241,16 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
-  for (auto const& name : m_fields_names) {
+  // Scorpio is not thread safe: wait for async writes once, before reading
+  // all the variables through their handles.
+  scorpio::IOWorker::instance().wait_all();
+
+  for (size_t i=0; i<m_fields_names.size(); ++i) {
+    const auto& name = m_fields_names[i];
 
     // Read the data
     auto v1d = m_host_views_1d.at(name);
-    scorpio::grid_read_data_array(m_filename,name,time_index,v1d.data(),v1d.size());
+    scorpio::grid_read_data_array(m_var_handles[i],time_index,v1d.data(),v1d.size());
 
     // If we have a field manager, make sure the data is correctly
     // synced to both host and device views of the field.
@@ -400,6 +406,7 @@ void AtmosphereInput::finalize()
 
   m_host_views_1d.clear();
   m_layouts.clear();
+  m_var_handles.clear();
 
   m_inited_with_views = false;
   m_inited_with_fields = false;
@@ -414,6 +421,12 @@ void AtmosphereInput::init_scorpio_structures()
 
   // Finish the definition phase for this file.
   scorpio::set_decomp  (m_filename); 
+
+  // Get the vars handles, so that read_variables does not look them up by name.
+  m_var_handles.clear();
+  for (auto const& name : m_fields_names) {
+    m_var_handles.push_back(scorpio::get_var_handle(m_filename,name));
+  }
 }
 
 /* ---------------------------------------------------------- */
@@ -168,6 +168,7 @@ protected:
   std::string               m_filename;
   std::string               m_io_grid_name;
   std::vector<std::string>  m_fields_names;
+  std::vector<int>          m_var_handles;  // Same order as m_fields_names
 
   bool m_inited_with_fields        = false;
   bool m_inited_with_views         = false;
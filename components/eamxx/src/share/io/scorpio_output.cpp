@@ -9,6 +9,7 @@
 #include "ekat/util/ekat_string_utils.hpp"
 #include "ekat/std_meta/ekat_std_utils.hpp"
 
+#include <functional>
 #include <numeric>
 #include <fstream>
 
@@ -74,12 +75,18 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::shared_ptr<const gm_type>& grids_mgr)
- : m_comm         (comm)
- , m_add_time_dim (true)
+                  const std::shared_ptr<const gm_type>& grids_mgr,
+                  const std::shared_ptr<DiagnosticRegistry>& diag_registry)
+ : m_comm          (comm)
+ , m_diag_registry (diag_registry)
+ , m_add_time_dim  (true)
 {
   using vos_t = std::vector<std::string>;
 
+  // The IO worker issues MPI calls from its own thread. If MPI was not initialized
+  // with MPI_THREAD_MULTIPLE, fall back to synchronous writes.
+  m_async_write = params.get("Async Write",false) && scorpio::IOWorker::is_supported();
+
   // Figure out what kind of averaging is requested
   auto avg_type = params.get<std::string>("Averaging Type");
   m_avg_type = str2avg(avg_type);
@@ -332,7 +339,8 @@ void AtmosphereOutput::init()
 
 } // init
 /*-----*/
-void AtmosphereOutput::run (const std::string& filename, const bool is_write_step, const int nsteps_since_last_output)
+void AtmosphereOutput::run (const std::string& filename, const bool is_write_step, const int nsteps_since_last_output,
+                            const util::TimeStamp& timestamp)
 {
   // If we do INSTANT output, but this is not an write step,
   // we can immediately return
@@ -345,9 +353,15 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
   // Update all diagnostics, we need to do this before applying the remapper
   // to make sure that the remapped fields are the most up to date.
   // First we reset the diag computed map so that all diags are recomputed.
+  // If the diags are shared with other streams, the registry computes them
+  // (and their dependencies) only if no other stream did at this time stamp.
   m_diag_computed.clear();
   for (auto& it : m_diagnostics) {
-    compute_diagnostic(it.first);
+    if (m_diag_registry) {
+      m_diag_registry->compute_diagnostic(*get_field_manager("sim"),it.first,timestamp);
+    } else {
+      compute_diagnostic(it.first);
+    }
   }
 
   auto apply_remap = [&](const std::shared_ptr<AbstractRemapper> remapper)
@@ -479,21 +493,65 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
       }
     }
 
-    if (is_write_step) {
-      if (avg_type==OutputAvgType::Average) {
-        // Divide by steps count only when the summation is complete
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-          data[i] /= nsteps_since_last_output;
-        });
-      }
-      // Bring data to host
-      auto view_host = m_host_views_1d.at(name);
-      Kokkos::deep_copy (view_host,view_dev);
-      grid_write_data_array(filename,name,view_host.data(),view_host.size());
+    if (is_write_step && avg_type==OutputAvgType::Average) {
+      // Divide by steps count only when the summation is complete
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+        data[i] /= nsteps_since_last_output;
+      });
     }
   }
+
+  if (is_write_step) {
+    write_fields(filename);
+  }
 } // run
 
+void AtmosphereOutput::write_fields (const std::string& filename)
+{
+  using namespace scorpio;
+
+  // Queue the device-to-host copies of all fields at once, and fence only once
+  const auto exec_space = KT::ExeSpace();
+  if (m_async_write) {
+    // Make sure the last write that used this staging buffer is done
+    auto& worker = IOWorker::instance();
+    start_timer("EAMxx::IO::async_write_wait");
+    worker.wait(m_write_tickets[m_staging_idx]);
+    stop_timer("EAMxx::IO::async_write_wait");
+
+    const auto& staging = m_staging_views_1d[m_staging_idx];
+    for (const auto& name : m_fields_names) {
+      Kokkos::deep_copy(exec_space,staging.at(name),m_dev_views_1d.at(name));
+    }
+    exec_space.fence();
+
+    // Hand the writes to the IO worker. Capture by value, since the worker
+    // may run the task after this call (and this object) are gone.
+    const auto names = m_fields_names;
+    const auto handles = m_var_handles.at(filename);
+    m_write_tickets[m_staging_idx] = worker.submit([=](){
+      for (size_t i=0; i<names.size(); ++i) {
+        const auto& view_host = staging.at(names[i]);
+        grid_write_data_array(handles[i],view_host.data(),view_host.size());
+      }
+    });
+    m_staging_idx = 1 - m_staging_idx;
+  } else {
+    for (const auto& name : m_fields_names) {
+      Kokkos::deep_copy(exec_space,m_host_views_1d.at(name),m_dev_views_1d.at(name));
+    }
+    exec_space.fence();
+
+    // Other streams may have pending async writes
+    IOWorker::instance().wait_all();
+    const auto& handles = m_var_handles.at(filename);
+    for (size_t i=0; i<m_fields_names.size(); ++i) {
+      const auto& view_host = m_host_views_1d.at(m_fields_names[i]);
+      grid_write_data_array(handles[i],view_host.data(),view_host.size());
+    }
+  }
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
   long long rdmf = 0;
@@ -535,6 +593,12 @@ res_dep_memory_footprint () const {
     }
   }
 
+  for (const auto& staging : m_staging_views_1d) {
+    for (const auto& it : staging) {
+      rdmf += it.second.size()*sizeof(Real);
+    }
+  }
+
   return rdmf;
 }
 /* ---------------------------------------------------------- */
@@ -662,6 +726,12 @@ void AtmosphereOutput::register_views()
       m_host_views_1d.emplace(name,Kokkos::create_mirror(m_dev_views_1d[name]));
 
     }
+
+    if (m_async_write) {
+      for (auto& staging : m_staging_views_1d) {
+        staging.emplace(name,view_1d_staging(Kokkos::view_alloc(Kokkos::WithoutInitializing,name),size));
+      }
+    }
   }
   // Initialize the local views
   reset_dev_views();
@@ -861,6 +931,21 @@ setup_output_file(const std::string& filename,
 
   // Set the offsets of the local dofs in the global vector.
   set_degrees_of_freedom(filename);
+
+  // Drop handles of files that have been closed since, then get the handles
+  // for this file, so that write_fields does not look up vars by name.
+  for (auto it=m_var_handles.begin(); it!=m_var_handles.end(); ) {
+    if (is_file_open_c2f(it->first.c_str(),Write)) {
+      ++it;
+    } else {
+      it = m_var_handles.erase(it);
+    }
+  }
+  auto& handles = m_var_handles[filename];
+  handles.clear();
+  for (const auto& name : m_fields_names) {
+    handles.push_back(get_var_handle(filename,name));
+  }
 }
 /* ---------------------------------------------------------- */
 // This routine will evaluate the diagnostics stored in this
@@ -919,6 +1004,10 @@ void AtmosphereOutput::set_diagnostics()
   //       field of certain diagnostics is itself a diagnostic,
   //       we want to make sure the required ones are all built.
   for (const auto& dd : m_diagnostics) {
+    if (m_diag_registry && m_diag_registry->has_diagnostic(*sim_field_mgr,dd.first)) {
+      // Diag set up by another output stream
+      continue;
+    }
     const auto& diag = dd.second;
     for (const auto& req : diag->get_required_field_requests()) {
       const auto& req_field = get_field(req.fid.name(),"sim");
@@ -929,12 +1018,44 @@ void AtmosphereOutput::set_diagnostics()
     //       output the diagnostic without computing it, we'll get an error.
     diag->initialize(util::TimeStamp(),RunType::Initial);
   }
+
+  // Share the new diags with other output streams. A diag must be added
+  // after the diags it depends on, so recurse on the dependencies first.
+  if (m_diag_registry) {
+    std::function<void(const std::string&)> add_to_registry = [&](const std::string& name) {
+      if (m_diag_registry->has_diagnostic(*sim_field_mgr,name)) {
+        return;
+      }
+      const auto& deps = m_diag_depends_on_diags.at(name);
+      for (const auto& dep : deps) {
+        add_to_registry(dep);
+      }
+      m_diag_registry->add_diagnostic(*sim_field_mgr,name,m_diagnostics.at(name),deps);
+    };
+    for (const auto& dd : m_diagnostics) {
+      add_to_registry(dd.first);
+    }
+  }
 }
 
 void AtmosphereOutput::
 create_diagnostic (const std::string& diag_field_name) {
   auto& diag_factory = AtmosphereDiagnosticFactory::instance();
 
+  // If another output stream already built this diag, reuse it. The registry
+  // knows its dependencies, so we don't need to track them here.
+  const auto sim_field_mgr = get_field_manager("sim");
+  if (m_diag_registry && m_diag_registry->has_diagnostic(*sim_field_mgr,diag_field_name)) {
+    auto diag = m_diag_registry->get_diagnostic(*sim_field_mgr,diag_field_name);
+    m_diagnostics.emplace(diag_field_name,diag);
+    m_diag_depends_on_diags[diag_field_name].resize(0);
+    if (diag->name() != diag_field_name) {
+      m_fields_alt_name.emplace(diag->name(),diag_field_name);
+      m_fields_alt_name.emplace(diag_field_name,diag->name());
+    }
+    return;
+  }
+
   // Construct a diagnostic by this name
   ekat::ParameterList params;
   std::string diag_name;
@@ -956,12 +1077,12 @@ create_diagnostic (const std::string& diag_field_name) {
     tokens.pop_back();
     auto fname = ekat::join(tokens,"_");
     // If the field is itself a diagnostic, make sure it's built
-    if (diag_factory.has_product(fname) and
-        m_diagnostics.count(fname)==0) {
-      create_diagnostic(fname);
+    m_diag_depends_on_diags[diag_field_name].resize(0);
+    if (diag_factory.has_product(fname)) {
+      if (m_diagnostics.count(fname)==0) {
+        create_diagnostic(fname);
+      }
       m_diag_depends_on_diags[diag_field_name].push_back(fname);
-    } else {
-      m_diag_depends_on_diags[diag_field_name].resize(0);
     }
     auto fid = get_field(fname,"sim").get_header().get_identifier();
     params.set("Field Name", fname);
@@ -984,12 +1105,12 @@ create_diagnostic (const std::string& diag_field_name) {
     tokens.pop_back();
     auto fname = ekat::join(tokens,"_");
     // If the field is itself a diagnostic, make sure it's built
-    if (diag_factory.has_product(fname) and
-        m_diagnostics.count(fname)==0) {
-      create_diagnostic(fname);
+    m_diag_depends_on_diags[diag_field_name].resize(0);
+    if (diag_factory.has_product(fname)) {
+      if (m_diagnostics.count(fname)==0) {
+        create_diagnostic(fname);
+      }
       m_diag_depends_on_diags[diag_field_name].push_back(fname);
-    } else {
-      m_diag_depends_on_diags[diag_field_name].resize(0);
     }
     auto fid = get_field(fname,"sim").get_header().get_identifier();
     params.set("Field Name", fname);
@@ -3,6 +3,8 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_io_worker.hpp"
+#include "share/io/scream_diagnostic_registry.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -28,6 +30,7 @@
  *  Casename:                     STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  Async Write:                  BOOL                  (default: false)
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -64,6 +67,9 @@
  *        - IO Grid Name: if provided, remap fields to this grid before output (useful to remap
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
+ *  - Async Write: if true, the data is copied to host staging buffers, and the actual writes
+ *    are performed by a background thread (see scream_io_worker.hpp), so that they can overlap
+ *    with the next atm steps. If MPI was not initialized with MPI_THREAD_MULTIPLE, the writes are synchronous.
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -123,6 +129,17 @@ public:
   using view_1d_dev  = view_Nd_dev<1>;
   using view_1d_host = view_Nd_host<1>;
 
+  // For async writes, we stage the data in host pinned memory (if available),
+  // so that device-to-host copies can be overlapped with other work.
+#if defined(KOKKOS_ENABLE_CUDA)
+  using staging_space = Kokkos::CudaHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_HIP)
+  using staging_space = Kokkos::Experimental::HIPHostPinnedSpace;
+#else
+  using staging_space = Kokkos::HostSpace;
+#endif
+  using view_1d_staging = Kokkos::View<Real*,staging_space>;
+
   virtual ~AtmosphereOutput () = default;
 
   // Constructor
@@ -133,9 +150,12 @@ public:
   //  - is_model_restart_output: if true, this Output is for model restart files.
   //    In this case, we have to also create an "rpointer.atm" file (which
   //    contains metadata, and is expected by the component coupled)
+  //  If a diagnostic registry is passed, diagnostics are shared with (and computed at
+  //  most once per time stamp across) all the output streams using the same registry.
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::shared_ptr<const gm_type>& grids_mgr);
+                   const std::shared_ptr<const gm_type>& grids_mgr,
+                   const std::shared_ptr<DiagnosticRegistry>& diag_registry = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -147,11 +167,14 @@ public:
   void init();
   void reset_dev_views();
   void setup_output_file (const std::string& filename, const std::string& fp_precision);
-  void run (const std::string& filename, const bool write, const int nsteps_since_last_output);
+  void run (const std::string& filename, const bool write, const int nsteps_since_last_output,
+            const util::TimeStamp& timestamp = util::TimeStamp());
   void finalize() {}
 
   long long res_dep_memory_footprint () const;
 
+  bool is_async_write () const { return m_async_write; }
+
   std::shared_ptr<const AbstractGrid> get_io_grid () const {
     return m_io_grid;
   }
@@ -171,6 +194,7 @@ protected:
   void set_degrees_of_freedom(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
+  void write_fields (const std::string& filename);
   Field get_field(const std::string& name, const std::string mode) const;
   void compute_diagnostic(const std::string& name);
   void set_diagnostics();
@@ -201,11 +225,23 @@ protected:
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
+  std::shared_ptr<DiagnosticRegistry>                   m_diag_registry;
+
+  // Scorpio handles of the output vars (same order as m_fields_names), for each open file.
+  // We may be writing to more than one file at once (e.g., history and checkpoint files).
+  std::map<std::string,std::vector<int>>                m_var_handles;
 
   // Local views of each field to be used for "averaging" output and writing to file.
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Host staging buffers for async writes. We keep two of them, so that a write step can
+  // copy data to host while the write of the previous output step is still in progress.
+  bool                                      m_async_write = false;
+  std::map<std::string,view_1d_staging>     m_staging_views_1d[2];
+  scorpio::IOWorker::ticket_type            m_write_tickets[2] = {0,0};
+  int                                       m_staging_idx = 0;
+
   bool m_add_time_dim;
 };
 
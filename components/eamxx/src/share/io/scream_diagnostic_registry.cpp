@@ -0,0 +1,62 @@
+#include "share/io/scream_diagnostic_registry.hpp"
+
+namespace scream
+{
+
+bool DiagnosticRegistry::
+has_diagnostic (const FieldManager& fm, const std::string& name) const
+{
+  return m_diags.find(key_type(&fm,name))!=m_diags.end();
+}
+
+DiagnosticRegistry::diag_ptr_type DiagnosticRegistry::
+get_diagnostic (const FieldManager& fm, const std::string& name) const
+{
+  auto it = m_diags.find(key_type(&fm,name));
+  EKAT_REQUIRE_MSG (it!=m_diags.end(),
+      "Error! Diagnostic '" + name + "' not found in the diagnostic registry.\n");
+  return it->second.diag;
+}
+
+void DiagnosticRegistry::
+add_diagnostic (const FieldManager& fm, const std::string& name,
+                const diag_ptr_type& diag,
+                const std::vector<std::string>& depends_on)
+{
+  EKAT_REQUIRE_MSG (diag!=nullptr,
+      "Error! Invalid pointer for diagnostic '" + name + "'.\n");
+  EKAT_REQUIRE_MSG (not has_diagnostic(fm,name),
+      "Error! Diagnostic '" + name + "' was already added to the diagnostic registry.\n");
+  for (const auto& dep : depends_on) {
+    EKAT_REQUIRE_MSG (has_diagnostic(fm,dep),
+        "Error! Diagnostic '" + name + "' depends on diagnostic '" + dep + "',\n"
+        "       which is not in the diagnostic registry.\n");
+  }
+
+  auto& info = m_diags[key_type(&fm,name)];
+  info.diag = diag;
+  info.depends_on = depends_on;
+}
+
+void DiagnosticRegistry::
+compute_diagnostic (const FieldManager& fm, const std::string& name,
+                    const util::TimeStamp& ts)
+{
+  auto it = m_diags.find(key_type(&fm,name));
+  EKAT_REQUIRE_MSG (it!=m_diags.end(),
+      "Error! Diagnostic '" + name + "' not found in the diagnostic registry.\n");
+
+  auto& info = it->second;
+  if (ts.is_valid() && info.last_computed.is_valid() && info.last_computed==ts) {
+    // Already computed by another output stream
+    return;
+  }
+
+  for (const auto& dep : info.depends_on) {
+    compute_diagnostic(fm,dep,ts);
+  }
+  info.diag->compute_diagnostic();
+  info.last_computed = ts;
+}
+
+} // namespace scream
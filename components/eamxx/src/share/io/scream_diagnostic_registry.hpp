@@ -0,0 +1,68 @@
+#ifndef SCREAM_DIAGNOSTIC_REGISTRY_HPP
+#define SCREAM_DIAGNOSTIC_REGISTRY_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A registry of diagnostics, to be shared by all output streams
+ *
+ * Without a registry, each AtmosphereOutput creates (and computes) its own
+ * diagnostics, so that a diagnostic requested by N output streams is computed
+ * N times per step. Instead, the first output stream requesting a diagnostic
+ * adds it here, and the other streams reuse the same object (and its output field).
+ *
+ * Diagnostics are identified by name *and* by the field manager storing their
+ * inputs: the same diagnostic computed from two different field managers is
+ * two different diagnostics.
+ *
+ * Diagnostics are computed lazily, at most once per time stamp. Before computing
+ * a diagnostic, we compute the diagnostics it depends on (if any).
+ */
+
+class DiagnosticRegistry {
+public:
+  using diag_ptr_type = std::shared_ptr<AtmosphereDiagnostic>;
+
+  bool has_diagnostic (const FieldManager& fm, const std::string& name) const;
+
+  diag_ptr_type get_diagnostic (const FieldManager& fm, const std::string& name) const;
+
+  // Add an (already initialized) diagnostic, along with the names of the
+  // diagnostics that must be computed before it.
+  void add_diagnostic (const FieldManager& fm, const std::string& name,
+                       const diag_ptr_type& diag,
+                       const std::vector<std::string>& depends_on);
+
+  // Compute the diagnostic, unless it was already computed at this time stamp.
+  // If the time stamp is invalid, the diagnostic is always computed.
+  void compute_diagnostic (const FieldManager& fm, const std::string& name,
+                           const util::TimeStamp& ts);
+
+  void clear () { m_diags.clear(); }
+
+protected:
+
+  struct DiagInfo {
+    diag_ptr_type             diag;
+    std::vector<std::string>  depends_on;
+    util::TimeStamp           last_computed;
+  };
+
+  using key_type = std::pair<const FieldManager*,std::string>;
+
+  std::map<key_type,DiagInfo>   m_diags;
+};
+
+} // namespace scream
+
+#endif // SCREAM_DIAGNOSTIC_REGISTRY_HPP
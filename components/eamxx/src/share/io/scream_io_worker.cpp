@@ -0,0 +1,115 @@
+#include "share/io/scream_io_worker.hpp"
+
+#include <mpi.h>
+
+namespace scream {
+namespace scorpio {
+
+IOWorker& IOWorker::instance () {
+  static IOWorker worker;
+  return worker;
+}
+
+IOWorker::~IOWorker () {
+  if (m_thread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+  }
+}
+
+bool IOWorker::is_supported () {
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided==MPI_THREAD_MULTIPLE;
+}
+
+IOWorker::ticket_type IOWorker::submit (const task_type& task) {
+  ticket_type ticket;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Lazy start, so that runs that never use async I/O don't spawn a thread
+    if (not m_thread.joinable()) {
+      m_thread = std::thread(&IOWorker::work,this);
+    }
+    m_tasks.push_back(task);
+    ticket = ++m_num_submitted;
+  }
+  m_cv.notify_all();
+  return ticket;
+}
+
+void IOWorker::wait (const ticket_type ticket) {
+  // A task waiting on the worker would never return
+  if (is_worker_thread()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cv.wait(lock,[&]{ return m_num_completed>=ticket; });
+  check_errors();
+}
+
+void IOWorker::wait_all () {
+  ticket_type ticket;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ticket = m_num_submitted;
+  }
+  wait(ticket);
+}
+
+IOWorker::ticket_type IOWorker::num_pending () {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_num_submitted - m_num_completed;
+}
+
+bool IOWorker::is_worker_thread () const {
+  return std::this_thread::get_id()==m_thread.get_id();
+}
+
+void IOWorker::work () {
+  while (true) {
+    task_type task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock,[&]{ return m_stop || not m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        // We were told to stop, and there is nothing left to do
+        return;
+      }
+      task = m_tasks.front();
+    }
+
+    try {
+      task();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (not m_error) {
+        m_error = std::current_exception();
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.pop_front();
+      ++m_num_completed;
+    }
+    m_cv.notify_all();
+  }
+}
+
+void IOWorker::check_errors () {
+  // NOTE: must be called with m_mutex locked
+  if (m_error) {
+    auto error = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace scorpio
+} // namespace scream
@@ -0,0 +1,78 @@
+#ifndef SCREAM_IO_WORKER_HPP
+#define SCREAM_IO_WORKER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace scream {
+namespace scorpio {
+
+/*
+ * A background thread that executes I/O tasks, in the order they are submitted.
+ *
+ * Scorpio (and PIO underneath) is not thread safe, so while the worker has
+ * pending tasks, the main thread must not call scorpio directly. Any task
+ * that needs to happen after a pending write (e.g., updating the time variable,
+ * or closing the file) must be submitted to the worker too. The scorpio
+ * interface calls that open files, read data, or finalize PIO take care of
+ * waiting for all pending tasks before proceeding.
+ *
+ * Since the tasks perform collective MPI operations on a thread other than
+ * the main one, the worker can only be used if MPI was initialized with
+ * MPI_THREAD_MULTIPLE (see is_supported()).
+ */
+
+class IOWorker {
+public:
+  using task_type   = std::function<void()>;
+  using ticket_type = long long;
+
+  static IOWorker& instance ();
+
+  ~IOWorker ();
+
+  // Whether the MPI library supports issuing MPI calls from the worker thread
+  static bool is_supported ();
+
+  // Queue a task, and return a ticket that can be used to wait for its completion.
+  ticket_type submit (const task_type& task);
+
+  // Block until the task with the given ticket (and all tasks before it) completed.
+  // If any task threw an exception, it is rethrown here.
+  void wait (const ticket_type ticket);
+
+  // Block until all submitted tasks are completed.
+  void wait_all ();
+
+  // The number of submitted tasks that are not completed yet
+  ticket_type num_pending ();
+
+  // Whether the calling thread is the worker thread
+  bool is_worker_thread () const;
+
+private:
+  IOWorker () = default;
+
+  void work ();
+  void check_errors ();
+
+  std::thread             m_thread;
+  std::mutex              m_mutex;
+  std::condition_variable m_cv;
+
+  std::deque<task_type>   m_tasks;
+  ticket_type             m_num_submitted = 0;
+  ticket_type             m_num_completed = 0;
+  bool                    m_stop = false;
+
+  std::exception_ptr      m_error;
+};
+
+} // namespace scorpio
+} // namespace scream
+
+#endif // SCREAM_IO_WORKER_HPP
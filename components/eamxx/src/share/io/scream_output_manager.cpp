@@ -9,6 +9,7 @@
 #include "ekat/util/ekat_string_utils.hpp"
 
 #include <fstream>
+#include <functional>
 #include <memory>
 
 namespace scream
@@ -72,9 +73,16 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   m_output_file_specs.filename_with_frequency   = out_control_pl.get("frequency_in_filename",true);
   m_output_file_specs.save_grid_data            = out_control_pl.get("save_grid_data",!m_is_model_restart_output);
 
+  // Model restart files must be complete by the time the run ends (or is killed),
+  // so never write them asynchronously. Async writes also require MPI_THREAD_MULTIPLE,
+  // so fall back to synchronous writes if MPI does not provide it.
+  m_async_write = m_params.get("Async Write",false) && not m_is_model_restart_output &&
+                  scorpio::IOWorker::is_supported();
+  m_params.set("Async Write",m_async_write);
+
   // For each grid, create a separate output stream.
   if (field_mgrs.size()==1) {
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr,m_diag_registry);
     m_output_streams.push_back(output);
   } else {
     const auto& fields_pl = m_params.sublist("Fields");
@@ -86,7 +94,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
       EKAT_REQUIRE_MSG (field_mgrs.find(gname)!=field_mgrs.end(),
           "Error! Output requested on grid '" + gname + "', but no field manager is available for such grid.\n");
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr,m_diag_registry);
       m_output_streams.push_back(output);
     }
   }
@@ -220,22 +228,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       setup_file(filespecs,control,timestamp);
     }
 
-    // If we are going to write an output checkpoint file, or a model restart file,
-    // we need to append to the filename ".rhist" or ".r" respectively, and add
-    // the filename to the rpointer.atm file.
-    if (m_is_model_restart_output || is_checkpoint_step) {
-      if (m_io_comm.am_i_root()) {
-        std::ofstream rpointer;
-        rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
-        rpointer << filename << std::endl;
-      }
-    }
-
     // Update time and nsteps in the output file
-    pio_update_time(filename,timestamp.days_from(m_case_t0));
+    const auto time = timestamp.days_from(m_case_t0);
+    run_io_task([=](){ pio_update_time(filename,time); });
     if (m_is_model_restart_output) {
       // Only write nsteps on model restart
-      set_int_attribute_c2f(filename.c_str(),"nsteps",timestamp.get_num_steps());
+      const int nsteps = timestamp.get_num_steps();
+      run_io_task([=](){ set_int_attribute_c2f(filename.c_str(),"nsteps",nsteps); });
     }
   }
   stop_timer(timer_root+"::get_new_file"); 
@@ -246,7 +245,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     // Note: filename might reference an invalid string, but it's only used
     //       in case is_write_step=true, in which case it will *for sure* contain
     //       a valid file name.
-    it->run(filename,is_write_step,m_output_control.nsamples_since_last_write);
+    it->run(filename,is_write_step,m_output_control.nsamples_since_last_write,timestamp);
   }
   stop_timer(timer_root+"::run_output_streams"); 
 
@@ -257,8 +256,8 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       const auto& type = type_any.first;
       const auto& any = type_any.second;
       if (type=="int") {
-        const int& value = ekat::any_cast<int>(any);
-        set_int_attribute_c2f(filename.c_str(),name.c_str(),value);
+        const int value = ekat::any_cast<int>(any);
+        run_io_task([=](){ set_int_attribute_c2f(filename.c_str(),name.c_str(),value); });
       } else {
         EKAT_ERROR_MSG ("Error! Unsupported global attribute type.\n"
             " - file name  : " + filename + "\n"
@@ -285,7 +284,8 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
     // Check if we need to close the output file
     if (filespecs.file_is_full()) {
-      eam_pio_closefile(filename);
+      const auto fname = filename;
+      run_io_task([=](){ eam_pio_closefile(fname); });
       filespecs.num_snapshots_in_file = 0;
       filespecs.is_open = false;
     }
@@ -295,16 +295,42 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     m_checkpoint_control.timestamp_of_last_write = timestamp;
   }
   stop_timer(timer_root+"::update_snapshot_tally"); 
+
+  // If we wrote an output checkpoint file, or a model restart file, add the
+  // filename to the rpointer.atm file. The file must be complete on disk before
+  // the rpointer references it, so wait for any pending async write first.
+  if (is_write_step && (m_is_model_restart_output || is_checkpoint_step)) {
+    scorpio::IOWorker::instance().wait_all();
+    if (m_io_comm.am_i_root()) {
+      std::ofstream rpointer;
+      rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
+      rpointer << filename << std::endl;
+    }
+  }
   stop_timer(timer_root); 
 }
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Make sure all pending writes are done
+  scorpio::IOWorker::instance().wait_all();
+
   // Swapping with an empty mgr is the easiest way to cleanup.
   OutputManager other;
   std::swap(*this,other);
 }
 
+void OutputManager::run_io_task (const std::function<void()>& task) const {
+  auto& worker = scorpio::IOWorker::instance();
+  if (m_async_write) {
+    worker.submit(task);
+  } else {
+    // Other output managers may have pending async writes
+    worker.wait_all();
+    task();
+  }
+}
+
 long long OutputManager::res_dep_memory_footprint () const {
   long long mf = 0;
   for (const auto& os : m_output_streams) {
@@ -398,6 +424,9 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
 {
   using namespace scorpio;
 
+  // We are about to call scorpio directly, so wait for any pending async write
+  IOWorker::instance().wait_all();
+
   const bool is_checkpoint_step = &control==&m_checkpoint_control;
   auto& filename = filespecs.filename;
 
@@ -4,6 +4,7 @@
 #include "share/io/scorpio_output.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_io_worker.hpp"
 
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -106,6 +107,11 @@ public:
     setup (io_comm,params,field_mgrs,grids_mgr,run_t0,run_t0,is_model_restart_output);
   }
 
+  // Share diagnostics with other output managers. Must be called before setup.
+  void set_diagnostic_registry (const std::shared_ptr<DiagnosticRegistry>& diag_registry) {
+    m_diag_registry = diag_registry;
+  }
+
   void setup_globals_map (const globals_map_t& globals);
   void run (const util::TimeStamp& current_ts);
   void finalize();
@@ -126,6 +132,10 @@ protected:
                    const IOControl& control,
                    const util::TimeStamp& timestamp);
 
+  // Runs a scorpio task right away or, if async write is on, queues it in the
+  // IO worker, so that it is executed after the pending writes of the output streams.
+  void run_io_task (const std::function<void()>& task) const;
+
   using output_type     = AtmosphereOutput;
   using output_ptr_type = std::shared_ptr<output_type>;
 
@@ -134,6 +144,9 @@ protected:
 
   globals_map_t                  m_globals;
 
+  // If set, diagnostics are shared with all the output managers using the same registry
+  std::shared_ptr<DiagnosticRegistry>   m_diag_registry;
+
   ekat::Comm                     m_io_comm;
   ekat::ParameterList            m_params;
 
@@ -146,6 +159,9 @@ protected:
   // Whether this OutputManager handles a model restart file, or normal model output.
   bool m_is_model_restart_output;
 
+  // Whether the output streams write asynchronously (see AtmosphereOutput)
+  bool m_async_write = false;
+
   // Frequency of output and checkpointing
   // See scream_io_utils.hpp for details.
   IOControl m_output_control;
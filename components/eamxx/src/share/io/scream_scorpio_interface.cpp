@@ -1,4 +1,5 @@
 #include "scream_scorpio_interface.hpp"
+#include "scream_io_worker.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 #include "scream_config.h"
 
@@ -25,6 +26,15 @@ extern "C" {
   void grid_write_data_array_c2f_int(const char*&& filename, const char*&& varname, const int* buf, const int buf_size);
   void grid_write_data_array_c2f_float(const char*&& filename, const char*&& varname, const float* buf, const int buf_size);
   void grid_write_data_array_c2f_double(const char*&& filename, const char*&& varname, const double* buf, const int buf_size);
+
+  int get_var_handle_c2f(const char*&& filename, const char*&& varname);
+  void grid_read_var_handle_c2f_int(const int handle, const Int time_index, int *buf, const int buf_size);
+  void grid_read_var_handle_c2f_float(const int handle, const Int time_index, float *buf, const int buf_size);
+  void grid_read_var_handle_c2f_double(const int handle, const Int time_index, double *buf, const int buf_size);
+
+  void grid_write_var_handle_c2f_int(const int handle, const int* buf, const int buf_size);
+  void grid_write_var_handle_c2f_float(const int handle, const float* buf, const int buf_size);
+  void grid_write_var_handle_c2f_double(const int handle, const double* buf, const int buf_size);
   void eam_init_pio_subsystem_c2f(const int mpicom, const int atm_id);
   void eam_pio_finalize_c2f();
   void eam_pio_closefile_c2f(const char*&& filename);
@@ -73,15 +83,21 @@ void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_finalize() {
+  // Make sure all async writes are done
+  IOWorker::instance().wait_all();
   eam_pio_finalize_c2f();
 }
 /* ----------------------------------------------------------------- */
 void register_file(const std::string& filename, const FileMode mode) {
+  // Scorpio is not thread safe: wait for async writes before touching scorpio structures
+  IOWorker::instance().wait_all();
   register_file_c2f(filename.c_str(),mode);
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_closefile(const std::string& filename) {
-
+  // Scorpio is not thread safe: wait for async writes before touching scorpio structures.
+  // NOTE: if called from the IO worker itself, this is a no-op.
+  IOWorker::instance().wait_all();
   eam_pio_closefile_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
@@ -147,16 +163,19 @@ void eam_pio_enddef(const std::string &filename) {
 template<>
 void grid_read_data_array<int>(const std::string &filename, const std::string &varname,
                           const int time_index, int *hbuf, const int buf_size) {
+  IOWorker::instance().wait_all();
   grid_read_data_array_c2f_int(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<float>(const std::string &filename, const std::string &varname,
                                 const int time_index, float *hbuf, const int buf_size) {
+  IOWorker::instance().wait_all();
   grid_read_data_array_c2f_float(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<double>(const std::string &filename, const std::string &varname,
                                   const int time_index, double *hbuf, const int buf_size) {
+  IOWorker::instance().wait_all();
   grid_read_data_array_c2f_double(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
@@ -173,5 +192,37 @@ void grid_write_data_array<double>(const std::string &filename, const std::strin
   grid_write_data_array_c2f_double(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
+int get_var_handle(const std::string &filename, const std::string &varname) {
+  // The handles table is modified here, so make sure no async write is using it
+  IOWorker::instance().wait_all();
+  return get_var_handle_c2f(filename.c_str(),varname.c_str());
+}
+/* ----------------------------------------------------------------- */
+template<>
+void grid_read_data_array<int>(const int var_handle, const int time_index, int *hbuf, const int buf_size) {
+  grid_read_var_handle_c2f_int(var_handle,time_index,hbuf,buf_size);
+}
+template<>
+void grid_read_data_array<float>(const int var_handle, const int time_index, float *hbuf, const int buf_size) {
+  grid_read_var_handle_c2f_float(var_handle,time_index,hbuf,buf_size);
+}
+template<>
+void grid_read_data_array<double>(const int var_handle, const int time_index, double *hbuf, const int buf_size) {
+  grid_read_var_handle_c2f_double(var_handle,time_index,hbuf,buf_size);
+}
+/* ----------------------------------------------------------------- */
+template<>
+void grid_write_data_array<int>(const int var_handle, const int* hbuf, const int buf_size) {
+  grid_write_var_handle_c2f_int(var_handle,hbuf,buf_size);
+}
+template<>
+void grid_write_data_array<float>(const int var_handle, const float* hbuf, const int buf_size) {
+  grid_write_var_handle_c2f_float(var_handle,hbuf,buf_size);
+}
+template<>
+void grid_write_data_array<double>(const int var_handle, const double* hbuf, const int buf_size) {
+  grid_write_var_handle_c2f_double(var_handle,hbuf,buf_size);
+}
+/* ----------------------------------------------------------------- */
 } // namespace scorpio
 } // namespace scream
@@ -60,6 +60,18 @@ namespace scorpio {
   void grid_write_data_array(const std::string &filename, const std::string &varname,
                              const T* hbuf, const int buf_size);
 
+  /* Get an opaque handle to a variable registered in an open file. Reading/writing
+   * via the handle avoids looking up the file and variable by name on the F90 side.
+   * The handle is valid until the file is closed (after which it may be reused). */
+  int get_var_handle (const std::string &filename, const std::string &varname);
+  /* Same as the two routines above, but the variable is specified via its handle.
+   * NOTE: unlike the by-name read, the read via handle does not wait for pending async
+   *       writes: the caller must drain the IOWorker once before reading a batch of vars. */
+  template<typename T>
+  void grid_read_data_array (const int var_handle, const int time_index, T* hbuf, const int buf_size);
+  template<typename T>
+  void grid_write_data_array (const int var_handle, const T* hbuf, const int buf_size);
+
 extern "C" {
   /* Query whether the pio subsystem is inited or not */
   bool is_eam_pio_subsystem_inited();
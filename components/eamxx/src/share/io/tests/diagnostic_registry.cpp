@@ -0,0 +1,118 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_diagnostic_registry.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+
+namespace {
+
+using namespace scream;
+
+// A diagnostic that only counts how many times it was computed
+class CountingDiag : public AtmosphereDiagnostic
+{
+public:
+  CountingDiag (const ekat::Comm& comm, const ekat::ParameterList& params)
+    : AtmosphereDiagnostic(comm,params)
+  {
+    // Nothing to do
+  }
+
+  std::string name() const { return m_params.get<std::string>("Diag Name"); }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+    using namespace ShortFieldTagsNames;
+
+    const auto grid = gm->get_grid("Point Grid");
+    FieldLayout lt ({COL},{grid->get_num_local_dofs()});
+    add_field<Required>("T",lt,K,grid->name());
+
+    m_diagnostic_output = Field(FieldIdentifier(name(),lt,K,grid->name()));
+    m_diagnostic_output.allocate_view();
+  }
+
+  int num_computes = 0;
+
+protected:
+  void compute_diagnostic_impl () { ++num_computes; }
+};
+
+TEST_CASE("diagnostic_registry","io")
+{
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto gm = create_mesh_free_grids_manager(comm,0,0,2,2*comm.size());
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+
+  // The input of the diagnostics
+  Field T (FieldIdentifier("T",FieldLayout({COL},{grid->get_num_local_dofs()}),K,grid->name()));
+  T.allocate_view();
+  T.get_header().get_tracking().update_time_stamp(t0);
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  fm->registration_begins();
+  fm->registration_ends();
+  fm->add_field(T);
+
+  auto create_diag = [&](const std::string& name) {
+    ekat::ParameterList params;
+    params.set<std::string>("Diag Name",name);
+    auto diag = std::make_shared<CountingDiag>(comm,params);
+    diag->set_grids(gm);
+    diag->set_required_field(T.get_const());
+    diag->initialize(t0,RunType::Initial);
+    return diag;
+  };
+  auto A = create_diag("A");
+  auto B = create_diag("B");
+
+  DiagnosticRegistry registry;
+
+  // Dependencies must be added first
+  REQUIRE_THROWS (registry.add_diagnostic(*fm,"B",B,{"A"}));
+  registry.add_diagnostic(*fm,"A",A,{});
+  registry.add_diagnostic(*fm,"B",B,{"A"});
+  REQUIRE_THROWS (registry.add_diagnostic(*fm,"A",A,{}));
+
+  REQUIRE (registry.has_diagnostic(*fm,"A"));
+  REQUIRE (registry.get_diagnostic(*fm,"B")==B);
+
+  // Diags are tied to the field manager storing their inputs
+  auto fm2 = std::make_shared<FieldManager>(grid);
+  REQUIRE (not registry.has_diagnostic(*fm2,"A"));
+
+  // Computing B computes A first. Later requests at the same time stamp are no-ops
+  auto t1 = t0 + 10;
+  registry.compute_diagnostic(*fm,"B",t1);
+  REQUIRE (A->num_computes==1);
+  REQUIRE (B->num_computes==1);
+  registry.compute_diagnostic(*fm,"A",t1);
+  registry.compute_diagnostic(*fm,"B",t1);
+  REQUIRE (A->num_computes==1);
+  REQUIRE (B->num_computes==1);
+
+  // A new time stamp triggers a new computation
+  auto t2 = t1 + 10;
+  registry.compute_diagnostic(*fm,"A",t2);
+  registry.compute_diagnostic(*fm,"B",t2);
+  REQUIRE (A->num_computes==2);
+  REQUIRE (B->num_computes==2);
+
+  // An invalid time stamp always triggers a computation
+  registry.compute_diagnostic(*fm,"B",util::TimeStamp());
+  REQUIRE (A->num_computes==3);
+  REQUIRE (B->num_computes==3);
+}
+
+} // anonymous namespace
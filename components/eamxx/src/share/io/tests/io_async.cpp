@@ -0,0 +1,243 @@
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_io_worker.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_manager.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_session.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_parameter_list.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+using namespace scream;
+
+std::shared_ptr<FieldManager>
+get_test_fm(std::shared_ptr<const AbstractGrid> grid, const util::TimeStamp& t0)
+{
+  using namespace ShortFieldTagsNames;
+  using namespace ekat::units;
+
+  using FL = FieldLayout;
+  using FR = FieldRequest;
+  using SL = std::list<std::string>;
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  const int num_lcols = grid->get_num_local_dofs();
+  const int num_levs = grid->get_num_vertical_levels();
+  const std::string& gn = grid->name();
+
+  FieldIdentifier fid1("field_1",FL{{COL},{num_lcols}},m,gn);
+  FieldIdentifier fid2("field_2",FL{{COL,LEV},{num_lcols,num_levs}},kg/m,gn);
+
+  fm->registration_begins();
+  fm->register_field(FR{fid1,SL{"output"}});
+  fm->register_field(FR{fid2,SL{"output"}});
+  fm->registration_ends();
+
+  fm->init_fields_time_stamp(t0);
+  for (const auto& fn : {"field_1","field_2"}) {
+    fm->get_field(fn).deep_copy(0.0);
+  }
+
+  return fm;
+}
+
+// Set f(i,k) = step + i/(k+1), so that all entries change at every step,
+// and averages are not exactly representable.
+void set_fields (const FieldManager& fm, const int step)
+{
+  auto f1 = fm.get_field("field_1");
+  auto f2 = fm.get_field("field_2");
+  auto v1 = f1.get_view<Real*,Host>();
+  auto v2 = f2.get_view<Real**,Host>();
+  for (int i=0; i<v2.extent_int(0); ++i) {
+    v1(i) = step + Real(i)/3;
+    for (int k=0; k<v2.extent_int(1); ++k) {
+      v2(i,k) = step + Real(i)/(k+1);
+    }
+  }
+  f1.sync_to_dev();
+  f2.sync_to_dev();
+  f1.get_header().get_tracking().update_time_stamp(f1.get_header().get_tracking().get_time_stamp()+1);
+  f2.get_header().get_tracking().update_time_stamp(f2.get_header().get_tracking().get_time_stamp()+1);
+}
+
+ekat::ParameterList get_om_params (const std::string& casename, const bool async)
+{
+  ekat::ParameterList params;
+  params.set<std::string>("Casename",casename);
+  params.set<std::string>("Averaging Type","Average");
+  params.set<int>("Max Snapshots Per File",2);
+  params.set<std::vector<std::string>>("Field Names",{"field_1","field_2"});
+  params.set<std::string>("Floating Point Precision","real");
+  params.set("Async Write",async);
+  auto& out_pl = params.sublist("output_control");
+  out_pl.set<int>("Frequency",4);
+  out_pl.set<std::string>("frequency_units","nsteps");
+  out_pl.set("MPI Ranks in Filename",true);
+  auto& ckp_pl = params.sublist("Checkpoint Control");
+  ckp_pl.set<int>("Frequency",2);
+  ckp_pl.set<std::string>("frequency_units","nsteps");
+  ckp_pl.set("MPI Ranks in Filename",true);
+  return params;
+}
+
+std::string get_filename (const std::string& casename, const std::string& suffix,
+                          const int freq, const ekat::Comm& comm, const util::TimeStamp& t)
+{
+  return casename + suffix + ".AVERAGE.nsteps_x" + std::to_string(freq) +
+         ".np" + std::to_string(comm.size()) + "." + t.to_string() + ".nc";
+}
+
+std::string last_rpointer_entry ()
+{
+  std::ifstream rpointer ("rpointer.atm");
+  std::string line, last;
+  while (rpointer >> line) {
+    last = line;
+  }
+  return last;
+}
+
+// Read the same snapshot from two files, and check that all fields match exactly
+void check_files_match (const std::string& file_sync, const std::string& file_async,
+                        const int nsnaps, const std::shared_ptr<const AbstractGrid>& grid,
+                        const util::TimeStamp& t0)
+{
+  auto fm_sync  = get_test_fm(grid,t0);
+  auto fm_async = get_test_fm(grid,t0);
+
+  auto get_in_params = [](const std::string& filename) {
+    ekat::ParameterList in_params;
+    in_params.set<std::string>("Filename",filename);
+    in_params.set<std::vector<std::string>>("Field Names",{"field_1","field_2"});
+    return in_params;
+  };
+
+  AtmosphereInput in_sync (get_in_params(file_sync),fm_sync);
+  AtmosphereInput in_async (get_in_params(file_async),fm_async);
+  for (int isnap=0; isnap<nsnaps; ++isnap) {
+    in_sync.read_variables(isnap);
+    in_async.read_variables(isnap);
+
+    // The time variable is 1-based
+    REQUIRE (scorpio::read_time_at_index_c2f(file_sync.c_str(),isnap+1)==
+             scorpio::read_time_at_index_c2f(file_async.c_str(),isnap+1));
+
+    for (const auto& fn : {"field_1","field_2"}) {
+      auto f_sync  = fm_sync->get_field(fn);
+      auto f_async = fm_async->get_field(fn);
+      f_sync.sync_to_host();
+      f_async.sync_to_host();
+      const int size = f_sync.get_header().get_identifier().get_layout().size();
+      auto p_sync  = f_sync.get_internal_view_data<const Real,Host>();
+      auto p_async = f_async.get_internal_view_data<const Real,Host>();
+      for (int i=0; i<size; ++i) {
+        REQUIRE (p_sync[i]==p_async[i]);
+      }
+    }
+  }
+  in_sync.finalize();
+  in_async.finalize();
+}
+
+TEST_CASE("async_output","io")
+{
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+
+  if (not scorpio::IOWorker::is_supported() && io_comm.am_i_root()) {
+    std::cout << " MPI does not provide MPI_THREAD_MULTIPLE: the async stream will write synchronously.\n";
+  }
+
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  ekat::ParameterList gm_params;
+  gm_params.set("number_of_global_columns",3*io_comm.size());
+  gm_params.set("number_of_vertical_levels",5);
+  auto gm = create_mesh_free_grids_manager(io_comm,gm_params);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+
+  // Two streams writing the same fields, one synchronously and one asynchronously
+  auto fm = get_test_fm(grid,t0);
+  const std::string case_sync  = "io_async_test_sync";
+  const std::string case_async = "io_async_test_async";
+  OutputManager om_sync, om_async;
+  om_sync.setup(io_comm,get_om_params(case_sync,false),fm,gm,t0,t0,false);
+  om_async.setup(io_comm,get_om_params(case_async,true),fm,gm,t0,t0,false);
+
+  // Output every 4 steps, with 2 snapshots per file, and checkpoints every 2 steps
+  // in between. With 12 steps, we get
+  //  - output files opened at steps 4 (closed at step 8) and 12 (closed at finalize)
+  //  - checkpoint files at steps 2, 6 and 10
+  const int nsteps = 12;
+  auto time = t0;
+  std::vector<util::TimeStamp> ckp_times;
+  for (int n=1; n<=nsteps; ++n) {
+    time += 1;
+    set_fields(*fm,n);
+    om_sync.run(time);
+    om_async.run(time);
+
+    if (n%4==2) {
+      // The rpointer file must reference the checkpoint file only once all its
+      // writes are done, so the async stream must have drained the worker by now.
+      ckp_times.push_back(time);
+      REQUIRE (scorpio::IOWorker::instance().num_pending()==0);
+      if (io_comm.am_i_root()) {
+        REQUIRE (last_rpointer_entry()==get_filename(case_async,".rhist",2,io_comm,time));
+      }
+    }
+  }
+  om_sync.finalize();
+  om_async.finalize();
+  REQUIRE (scorpio::IOWorker::instance().num_pending()==0);
+
+  // Output files: the first one was closed by the worker after its second snapshot
+  auto t4 = t0 + 4;
+  auto t12 = t0 + 12;
+  check_files_match(get_filename(case_sync,"",4,io_comm,t4),
+                    get_filename(case_async,"",4,io_comm,t4),2,grid,t0);
+  check_files_match(get_filename(case_sync,"",4,io_comm,t12),
+                    get_filename(case_async,"",4,io_comm,t12),1,grid,t0);
+
+  // Checkpoint files
+  for (const auto& t : ckp_times) {
+    check_files_match(get_filename(case_sync,".rhist",2,io_comm,t),
+                      get_filename(case_async,".rhist",2,io_comm,t),1,grid,t0);
+  }
+
+  scorpio::eam_pio_finalize();
+}
+
+} // anonymous namespace
+
+int main (int argc, char** argv) {
+  // The IO worker issues MPI calls from its own thread
+  int provided;
+  MPI_Init_thread(&argc,&argv,MPI_THREAD_MULTIPLE,&provided);
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  // The command line args are for the scream session (e.g., kokkos options)
+  scream::initialize_scream_session(argc,argv,comm.am_i_root());
+  const int num_failed = Catch::Session().run(1,argv);
+  scream::finalize_scream_session();
+
+  MPI_Finalize();
+  return num_failed!=0 ? 1 : 0;
+}
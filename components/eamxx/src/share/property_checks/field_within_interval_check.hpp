@@ -41,6 +41,9 @@ public:
 
   ResultAndMsg check() const override;
 
+  double lower_bound () const { return m_lb; }
+  double upper_bound () const { return m_ub; }
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef EAMXX_ENABLE_GPU
 protected:
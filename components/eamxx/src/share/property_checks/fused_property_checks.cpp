@@ -0,0 +1,213 @@
+#include "share/property_checks/fused_property_checks.hpp"
+#include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/field_within_interval_check.hpp"
+
+#include <ekat/util/ekat_math_utils.hpp>
+
+#include <cstdint>
+#include <tuple>
+
+namespace scream
+{
+
+namespace impl {
+
+// For each field in a batch, computes min, max, and whether there are
+// invalid entries. All fields share the same layout, so the reduction
+// is over the layout entries, and the inner loop runs over the fields.
+// The reduction value is an array, with 3 entries per field.
+template<typename ST>
+struct FusedMinMaxInvalid {
+  using KT = KokkosTypes<DefaultDevice>;
+
+  using value_type = ST[];
+  using size_type  = typename KT::MemSpace::size_type;
+
+  size_type value_count;
+
+  int num_fields;
+  int last_dim;
+  KT::view_1d<const std::uintptr_t>  data;
+  KT::view_1d<const int>             last_extents;
+
+  KOKKOS_INLINE_FUNCTION
+  void init (value_type v) const {
+    for (int f=0; f<num_fields; ++f) {
+      v[3*f+0] = Kokkos::reduction_identity<ST>::min();
+      v[3*f+1] = Kokkos::reduction_identity<ST>::max();
+      v[3*f+2] = 0;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join (value_type dst, const value_type src) const {
+    for (int f=0; f<num_fields; ++f) {
+      dst[3*f+0] = src[3*f+0]<dst[3*f+0] ? src[3*f+0] : dst[3*f+0];
+      dst[3*f+1] = src[3*f+1]>dst[3*f+1] ? src[3*f+1] : dst[3*f+1];
+      dst[3*f+2] = src[3*f+2]>dst[3*f+2] ? src[3*f+2] : dst[3*f+2];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int idx, value_type v) const {
+    // Fields may have different padding, so compute the offset
+    // in each field using its allocated last extent.
+    const int outer = idx / last_dim;
+    const int inner = idx % last_dim;
+    for (int f=0; f<num_fields; ++f) {
+      const ST* ptr = reinterpret_cast<const ST*>(data(f));
+      const ST x = ptr[outer*last_extents(f) + inner];
+      if (ekat::is_invalid(x)) {
+        v[3*f+2] = 1;
+      }
+      if (x<v[3*f+0]) {
+        v[3*f+0] = x;
+      }
+      if (x>v[3*f+1]) {
+        v[3*f+1] = x;
+      }
+    }
+  }
+};
+
+} // namespace impl
+
+void FusedPropertyChecks::
+set_checks (const std::vector<prop_check_ptr>& checks)
+{
+  m_checks_info.clear();
+  m_batches.clear();
+
+  // Find the batch (and index within the batch) of the given field, adding it if needed
+  auto get_batch_and_idx = [&](const Field& f) -> std::pair<int,int> {
+    const auto& dims = f.get_header().get_identifier().get_layout().dims();
+    for (size_t ib=0; ib<m_batches.size(); ++ib) {
+      auto& b = m_batches[ib];
+      if (b.data_type!=f.data_type() || b.dims!=dims) {
+        continue;
+      }
+      for (size_t i=0; i<b.fields.size(); ++i) {
+        if (b.fields[i].get_header().get_identifier()==f.get_header().get_identifier()) {
+          return std::make_pair(static_cast<int>(ib),static_cast<int>(i));
+        }
+      }
+      b.fields.push_back(f);
+      return std::make_pair(static_cast<int>(ib),static_cast<int>(b.fields.size()-1));
+    }
+    m_batches.emplace_back();
+    m_batches.back().data_type = f.data_type();
+    m_batches.back().dims = dims;
+    m_batches.back().fields.push_back(f);
+    return std::make_pair(static_cast<int>(m_batches.size()-1),0);
+  };
+
+  for (const auto& pc : checks) {
+    m_checks_info.emplace_back();
+    auto& info = m_checks_info.back();
+
+    // Only single-field pointwise checks are fused. We also skip subfields
+    // (and rank-0 fields), since we need to access the data via a raw pointer.
+    const auto& f = pc->fields().front();
+    const bool fusable_field = pc->fields().size()==1 && f.rank()>0 &&
+                               f.get_header().get_parent().expired();
+    if (not fusable_field) {
+      continue;
+    }
+
+    if (dynamic_cast<const FieldNaNCheck*>(pc.get())!=nullptr) {
+      info.kind = CheckKind::NaN;
+    } else if (auto fwic = dynamic_cast<const FieldWithinIntervalCheck*>(pc.get())) {
+      info.kind = CheckKind::WithinInterval;
+      info.lb = fwic->lower_bound();
+      info.ub = fwic->upper_bound();
+    } else {
+      continue;
+    }
+    std::tie(info.batch,info.field_idx) = get_batch_and_idx(f);
+  }
+
+  // Store data pointers and last extents of all fields in each batch
+  for (auto& b : m_batches) {
+    const int nfields = b.fields.size();
+    b.data = decltype(b.data)("",nfields);
+    b.last_extents = decltype(b.last_extents)("",nfields);
+    auto data_h = Kokkos::create_mirror_view(b.data);
+    auto last_extents_h = Kokkos::create_mirror_view(b.last_extents);
+    for (int i=0; i<nfields; ++i) {
+      const auto& f = b.fields[i];
+      data_h(i) = reinterpret_cast<std::uintptr_t>(f.get_internal_view_data<const char>());
+      last_extents_h(i) = f.get_header().get_alloc_properties().get_last_extent();
+    }
+    Kokkos::deep_copy(b.data,data_h);
+    Kokkos::deep_copy(b.last_extents,last_extents_h);
+  }
+}
+
+template<typename ST>
+std::vector<double> FusedPropertyChecks::run_batch (const int ibatch) const
+{
+  const auto& b = m_batches[ibatch];
+  const int nfields = b.fields.size();
+
+  long long size = 1;
+  for (auto d : b.dims) {
+    size *= d;
+  }
+
+  impl::FusedMinMaxInvalid<ST> func;
+  func.value_count  = 3*nfields;
+  func.num_fields   = nfields;
+  func.last_dim     = b.dims.back();
+  func.data         = b.data;
+  func.last_extents = b.last_extents;
+
+  Kokkos::View<ST*,Kokkos::HostSpace> result("",3*nfields);
+  Kokkos::parallel_reduce(KT::RangePolicy(0,size),func,result);
+
+  return std::vector<double>(result.data(),result.data()+3*nfields);
+}
+
+std::vector<bool> FusedPropertyChecks::run () const
+{
+  // One fused kernel per batch
+  std::vector<std::vector<double>> stats(m_batches.size());
+  for (size_t ib=0; ib<m_batches.size(); ++ib) {
+    switch (m_batches[ib].data_type) {
+      case DataType::IntType:
+        stats[ib] = run_batch<int>(ib);
+        break;
+      case DataType::FloatType:
+        stats[ib] = run_batch<float>(ib);
+        break;
+      case DataType::DoubleType:
+        stats[ib] = run_batch<double>(ib);
+        break;
+      default:
+        EKAT_ERROR_MSG (
+            "Internal error in FusedPropertyChecks: unsupported field data type.\n"
+            "You should not have reached this line. Please, contact developers.\n");
+    }
+  }
+
+  // Same pass criteria as in FieldNaNCheck and FieldWithinIntervalCheck
+  std::vector<bool> pass(m_checks_info.size(),false);
+  for (size_t i=0; i<m_checks_info.size(); ++i) {
+    const auto& info = m_checks_info[i];
+    if (info.kind==CheckKind::NotFused) {
+      continue;
+    }
+    const auto& s = stats[info.batch];
+    const double min_val = s[3*info.field_idx+0];
+    const double max_val = s[3*info.field_idx+1];
+    const bool   invalid = s[3*info.field_idx+2]!=0;
+    if (info.kind==CheckKind::NaN) {
+      pass[i] = not invalid;
+    } else {
+      pass[i] = min_val>=info.lb && max_val<=info.ub;
+    }
+  }
+
+  return pass;
+}
+
+} // namespace scream
@@ -0,0 +1,85 @@
+#ifndef SCREAM_FUSED_PROPERTY_CHECKS_HPP
+#define SCREAM_FUSED_PROPERTY_CHECKS_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/field/field.hpp"
+#include "share/scream_types.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A class to pre-screen many pointwise property checks at once
+ *
+ * Running each PropertyCheck separately costs one kernel launch (and fence)
+ * per check. This class groups the FieldNaNCheck and FieldWithinIntervalCheck
+ * objects (the latter including lower/upper bound checks) of a list of checks
+ * by field layout and data type. For each group, a single fused parallel_reduce
+ * computes min, max, and presence of NaN's for all the fields of the group.
+ * From these, we can tell which checks surely pass.
+ *
+ * Checks that cannot be fused (non-pointwise checks, or checks on subfields),
+ * as well as fused checks that do not pass, must still be run individually
+ * via PropertyCheck::check. That is also where the detailed message (with the
+ * failure location) is produced, so messages are only built upon failure.
+ */
+
+class FusedPropertyChecks {
+public:
+  using prop_check_ptr = std::shared_ptr<PropertyCheck>;
+
+  // Set the checks to pre-screen. Can be called again to reset the list.
+  void set_checks (const std::vector<prop_check_ptr>& checks);
+
+  // Run the fused kernels, and return, for each check (in the same order as
+  // in set_checks), whether the check is known to pass.
+  std::vector<bool> run () const;
+
+  int num_checks () const { return m_checks_info.size(); }
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+
+  template<typename ST>
+  std::vector<double> run_batch (const int ibatch) const;
+
+protected:
+
+  using KT = KokkosTypes<DefaultDevice>;
+
+  // A batch of fields with the same layout and data type
+  struct Batch {
+    DataType              data_type;
+    std::vector<int>      dims;
+    std::vector<Field>    fields;
+
+    // Pointers to the fields data, and their allocated last extent
+    KT::view_1d<std::uintptr_t>  data;
+    KT::view_1d<int>             last_extents;
+  };
+
+  enum class CheckKind {
+    NotFused,
+    NaN,
+    WithinInterval
+  };
+
+  struct CheckInfo {
+    CheckKind kind = CheckKind::NotFused;
+    int       batch = -1;
+    int       field_idx = -1;
+    double    lb, ub;
+  };
+
+  std::vector<CheckInfo>    m_checks_info;
+  std::vector<Batch>        m_batches;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FUSED_PROPERTY_CHECKS_HPP
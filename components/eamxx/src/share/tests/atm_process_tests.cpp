@@ -6,6 +6,7 @@
 #include "share/atm_process/atmosphere_diagnostic.hpp"
 
 #include "share/property_checks/field_lower_bound_check.hpp"
+#include "share/field/derived_thermo_state.hpp"
 
 #include "share/grid/se_grid.hpp"
 #include "share/grid/point_grid.hpp"
@@ -18,6 +19,9 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 
+#include <map>
+#include <set>
+
 namespace scream {
 
 ekat::ParameterList create_test_params ()
@@ -314,7 +318,7 @@ public:
   AddOne (const ekat::Comm& comm,const ekat::ParameterList& params)
    : DummyProcess(comm,params)
   {
-    // Nothing to do here
+    m_field_name = m_params.get<std::string>("Field Name","Field A");
   }
 
   // The type of the atm proc
@@ -326,16 +330,117 @@ public:
     const auto grid = gm->get_grid(m_grid_name);
     const auto lt = grid->get_2d_scalar_layout ();
 
-    add_field<Updated>("Field A",lt,K,m_grid_name);
+    add_field<Updated>(m_field_name,lt,K,m_grid_name);
   }
 protected:
     void run_impl (const double /* dt */) {
-    auto v = get_field_out("Field A", m_grid_name).get_view<Real*,Host>();
+    auto f = get_field_out(m_field_name, m_grid_name);
+    auto v = f.get_view<Real*,Host>();
 
+    f.sync_to_host();
     for (int i=0; i<v.extent_int(0); ++i) {
       v[i] += Real(1.0);
     }
+    f.sync_to_dev();
+  }
+
+  std::string m_field_name;
+};
+
+class TimesTwo : public DummyProcess
+{
+public:
+  TimesTwo (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    m_field_name = m_params.get<std::string>("Field Name","Field A");
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    add_field<Updated>(m_field_name,lt,K,m_grid_name);
+  }
+protected:
+    void run_impl (const double /* dt */) {
+    auto f = get_field_out(m_field_name, m_grid_name);
+    auto v = f.get_view<Real*,Host>();
+
+    f.sync_to_host();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      v[i] *= Real(2.0);
+    }
+    f.sync_to_dev();
+  }
+
+  std::string m_field_name;
+};
+
+// Heats the atmosphere at every run, after checking that the dz
+// provided by DerivedThermoState is consistent with the current state
+class Heater : public DummyProcess
+{
+public:
+  Heater (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_3d_scalar_layout (true);
+    constexpr int ps = SCREAM_PACK_SIZE;
+
+    add_field<Updated>("T_mid",lt,K,m_grid_name,ps);
+    add_field<Required>("p_mid",lt,Pa,m_grid_name,ps);
+    add_field<Required>("pseudo_density",lt,Pa,m_grid_name,ps);
+    add_field<Required>("qv",lt,kg/kg,m_grid_name,ps);
+  }
+
+  int num_runs = 0;
+protected:
+  void initialize_impl (const RunType /* run_type */ ) {
+    m_dts = DerivedThermoState::get_instance(get_field_out("T_mid"),get_field_in("p_mid"),
+                                             get_field_in("pseudo_density"),get_field_in("qv"));
+  }
+
+  void run_impl (const double /* dt */) {
+    using PF = PhysicsFunctions<HostDevice>;
+
+    auto T_mid = get_field_out("T_mid");
+    const auto& dz = m_dts->get_dz();
+    for (const auto& f : {T_mid,dz,get_field_in("p_mid"),get_field_in("pseudo_density"),get_field_in("qv")}) {
+      f.sync_to_host();
+    }
+    auto T  = T_mid.get_view<Real**,Host>();
+    auto p  = get_field_in("p_mid").get_view<const Real**,Host>();
+    auto dp = get_field_in("pseudo_density").get_view<const Real**,Host>();
+    auto qv = get_field_in("qv").get_view<const Real**,Host>();
+    auto dz_h = dz.get_view<const Real**,Host>();
+    const auto& layout = T_mid.get_header().get_identifier().get_layout();
+    for (int i=0; i<layout.dim(0); ++i) {
+      for (int k=0; k<layout.dim(1); ++k) {
+        REQUIRE (dz_h(i,k)==Approx(PF::calculate_dz(dp(i,k),p(i,k),T(i,k),qv(i,k))));
+        T(i,k) += 10;
+      }
+    }
+    T_mid.sync_to_dev();
+    ++num_runs;
   }
+
+  std::shared_ptr<DerivedThermoState> m_dts;
 };
 
 // ================================ TESTS ============================== //
@@ -613,6 +718,160 @@ TEST_CASE ("subcycling") {
   }
 }
 
+TEST_CASE ("subcycled_derived_state") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("Heater",&create_atmosphere_process<Heater>);
+  factory.register_product("grouP",&create_atmosphere_process<AtmosphereProcessGroup>);
+
+  // Within a subcycled group, T_mid is modified at every subcycle, but its time stamp
+  // is updated only at the end. The Heater checks that dz is recomputed nonetheless.
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set<std::string>("schedule_type","Sequential");
+  params.set<std::string>("atm_procs_list","(Heater)");
+  params.set<int>("number_of_subcycles",3);
+  params.sublist("Heater").set<std::string>("Grid Name", "Point Grid");
+
+  auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  group->set_grids(gm);
+
+  std::map<std::string,Real> init_vals = {
+    {"T_mid",300}, {"p_mid",1e5}, {"pseudo_density",100}, {"qv",0.01}
+  };
+  std::set<std::string> computed;
+  for(const auto& req : group->get_computed_field_requests()) {
+    Field f(req.fid);
+    f.get_header().get_alloc_properties().request_allocation(req.pack_size);
+    f.allocate_view();
+    f.deep_copy(init_vals.at(f.name()));
+    f.get_header().get_tracking().update_time_stamp(t0);
+    group->set_required_field(f.get_const());
+    group->set_computed_field(f);
+    computed.insert(f.name());
+  }
+  for(const auto& req : group->get_required_field_requests()) {
+    if (computed.count(req.fid.name())==1) {
+      continue;
+    }
+    Field f(req.fid);
+    f.get_header().get_alloc_properties().request_allocation(req.pack_size);
+    f.allocate_view();
+    f.deep_copy(init_vals.at(f.name()));
+    f.get_header().get_tracking().update_time_stamp(t0);
+    group->set_required_field(f.get_const());
+  }
+
+  group->initialize(t0,RunType::Initial);
+  group->run(300);
+  group->run(300);
+
+  auto heater = std::dynamic_pointer_cast<const Heater>(group->get_process(0));
+  REQUIRE (heater->num_runs==6);
+}
+
+TEST_CASE ("schedule_type") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("AddOne",&create_atmosphere_process<AddOne>);
+  factory.register_product("TimesTwo",&create_atmosphere_process<TimesTwo>);
+  factory.register_product("grouP",&create_atmosphere_process<AtmosphereProcessGroup>);
+
+  // Starting from x=1, we should get
+  //  - sequential splitting: (x+1)*2 = 4
+  //  - parallel splitting: x + ((x+1)-x) + (2x-x) = 3
+  for (std::string sched_type : {"Sequential","Parallel"}) {
+    ekat::ParameterList params ("Atmosphere Processes");
+    params.set<std::string>("schedule_type",sched_type);
+    params.set<std::string>("atm_procs_list","(AddOne,TimesTwo)");
+    params.sublist("AddOne").set<std::string>("Grid Name", "Point Grid");
+    params.sublist("TimesTwo").set<std::string>("Grid Name", "Point Grid");
+
+    std::shared_ptr<AtmosphereProcess> group (factory.create("group",comm,params));
+    group->set_grids(gm);
+
+    Field f;
+    for(const auto& req : group->get_computed_field_requests()) {
+      f = Field(req.fid);
+      f.allocate_view();
+      f.deep_copy(1);
+      f.get_header().get_tracking().update_time_stamp(t0);
+    }
+    // Field A is updated by the first process, so it is an input of the group
+    // for both schedule types.
+    group->set_required_field(f.get_const());
+    group->set_computed_field(f);
+
+    group->initialize(t0,RunType::Initial);
+    group->run(1);
+
+    const Real expected = sched_type=="Parallel" ? 3 : 4;
+    f.sync_to_host();
+    auto v = f.get_view<const Real*,Host>();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      REQUIRE (v[i]==expected);
+    }
+  }
+
+  // If the processes update different fields, they are independent, and a
+  // parallel group can run them concurrently. Starting from A=B=1, we should
+  // get A=2 and B=2, regardless of the schedule type.
+  for (std::string sched_type : {"Sequential","Parallel"}) {
+    ekat::ParameterList params ("Atmosphere Processes");
+    params.set<std::string>("schedule_type",sched_type);
+    params.set<std::string>("atm_procs_list","(AddOne,TimesTwo)");
+    params.sublist("AddOne").set<std::string>("Grid Name", "Point Grid");
+    params.sublist("TimesTwo").set<std::string>("Grid Name", "Point Grid");
+    params.sublist("TimesTwo").set<std::string>("Field Name", "Field B");
+
+    std::shared_ptr<AtmosphereProcess> group (factory.create("group",comm,params));
+    group->set_grids(gm);
+
+    std::vector<Field> fields;
+    for(const auto& req : group->get_computed_field_requests()) {
+      Field f(req.fid);
+      f.allocate_view();
+      f.deep_copy(1);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      group->set_required_field(f.get_const());
+      group->set_computed_field(f);
+      fields.push_back(f);
+    }
+    REQUIRE (fields.size()==2);
+
+    group->initialize(t0,RunType::Initial);
+    group->run(1);
+
+    for (auto& f : fields) {
+      f.sync_to_host();
+      auto v = f.get_view<const Real*,Host>();
+      for (int i=0; i<v.extent_int(0); ++i) {
+        REQUIRE (v[i]==2);
+      }
+      REQUIRE (f.get_header().get_tracking().get_time_stamp()==t0+1);
+    }
+  }
+}
+
 TEST_CASE ("diagnostics") {
 
   //TODO: This test needs a field manager so that changes in Field A are seen everywhere.
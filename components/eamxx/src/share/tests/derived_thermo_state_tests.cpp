@@ -0,0 +1,130 @@
+#include <catch2/catch.hpp>
+
+#include "share/field/derived_thermo_state.hpp"
+#include "share/field/field.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include "ekat/ekat_pack.hpp"
+
+#include <memory>
+
+namespace {
+
+TEST_CASE("derived_thermo_state") {
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+  using namespace ekat::units;
+  using PF = PhysicsFunctions<HostDevice>;
+
+  const int ncols = 3;
+  const int nlevs = 13;
+
+  FieldLayout layout ({COL,LEV},{ncols,nlevs});
+  auto create_field = [&](const std::string& name, const Units& u, const Real val) {
+    FieldIdentifier fid (name,layout,u,"some_grid");
+    Field f(fid);
+    f.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+    f.allocate_view();
+    f.deep_copy(val);
+    return f;
+  };
+
+  // The state is uniform, so dz is the same everywhere
+  Real T_val = 300.0, p_val = 1e5, dp_val = 100.0, qv_val = 0.01;
+  auto expected_dz = [&]() {
+    return PF::calculate_dz(dp_val,p_val,T_val,qv_val);
+  };
+  auto check_dz = [&](const Field& dz, const Real expected) {
+    dz.sync_to_host();
+    auto dz_h = dz.get_view<const Real**,Host>();
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int ilev=0; ilev<nlevs; ++ilev) {
+        REQUIRE (dz_h(icol,ilev)==Approx(expected));
+      }
+    }
+  };
+
+  auto T_mid = create_field("T_mid",K,T_val);
+  auto p_mid = create_field("p_mid",Pa,p_val);
+  auto pseudo_density = create_field("pseudo_density",Pa,dp_val);
+  auto qv = create_field("qv",kg/kg,qv_val);
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+  for (auto f : {T_mid,p_mid,pseudo_density,qv}) {
+    f.get_header().get_tracking().update_time_stamp(t0);
+  }
+
+  auto dts = DerivedThermoState::get_instance(T_mid,p_mid,pseudo_density,qv);
+
+  SECTION ("sharing") {
+    // Same state fields -> same object
+    REQUIRE (DerivedThermoState::get_instance(T_mid,p_mid,pseudo_density,qv)==dts);
+
+    // Different state fields -> different object
+    auto qv2 = create_field("qv",kg/kg,0.02);
+    REQUIRE (DerivedThermoState::get_instance(T_mid,p_mid,pseudo_density,qv2)!=dts);
+
+    // Once all clients release the object, the weak_ptr expires, and a new one is built
+    std::weak_ptr<DerivedThermoState> wp = dts;
+    dts.reset();
+    REQUIRE (wp.expired());
+    dts = DerivedThermoState::get_instance(T_mid,p_mid,pseudo_density,qv);
+    REQUIRE (dts!=nullptr);
+    REQUIRE (DerivedThermoState::get_instance(T_mid,p_mid,pseudo_density,qv)==dts);
+  }
+
+  SECTION ("caching") {
+    const Real dz0 = expected_dz();
+    const auto& dz = dts->get_dz();
+    check_dz(dz,dz0);
+
+    // The quantity is stamped with the state time stamp
+    REQUIRE (dz.get_header().get_tracking().get_time_stamp()==t0);
+
+    // Modify the state via its view: the change is not detected, and the cached value is reused
+    T_val = 250.0;
+    auto T_h = T_mid.get_view<Real**,Host>();
+    Kokkos::deep_copy(T_h,T_val);
+    T_mid.sync_to_dev();
+    REQUIRE (&dts->get_dz()==&dz);
+    check_dz(dts->get_dz(),dz0);
+    REQUIRE (expected_dz()!=Approx(dz0));
+
+    // Once the field is marked as modified, dz is recomputed, even if the time stamp did not change
+    T_mid.get_header().get_tracking().mark_modified();
+    check_dz(dts->get_dz(),expected_dz());
+    REQUIRE (dts->get_dz().get_header().get_tracking().get_time_stamp()==t0);
+
+    // Field::deep_copy and Field::update mark the field as modified
+    qv_val = 0.02;
+    qv.deep_copy(qv_val);
+    check_dz(dts->get_dz(),expected_dz());
+
+    // dp -> 2*dp
+    dp_val = 200.0;
+    pseudo_density.update(pseudo_density,Real(1),Real(1));
+    check_dz(dts->get_dz(),expected_dz());
+
+    // So does updating the time stamp
+    auto t1 = t0 + 300;
+    T_val = 280.0;
+    Kokkos::deep_copy(T_h,T_val);
+    T_mid.sync_to_dev();
+    T_mid.get_header().get_tracking().update_time_stamp(t1);
+    check_dz(dts->get_dz(),expected_dz());
+    REQUIRE (dts->get_dz().get_header().get_tracking().get_time_stamp()==t1);
+
+    // Quantities computed from dz are consistent with it
+    const Real dz1 = expected_dz();
+    auto z_int = dts->get_z_int();
+    z_int.sync_to_host();
+    auto z_int_h = z_int.get_view<const Real**,Host>();
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int ilev=0; ilev<=nlevs; ++ilev) {
+        REQUIRE (z_int_h(icol,ilev)==Approx(dz1*(nlevs-ilev)));
+      }
+    }
+  }
+}
+
+} // anonymous namespace
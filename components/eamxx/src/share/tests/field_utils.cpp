@@ -172,6 +172,45 @@ TEST_CASE("utils") {
     REQUIRE(field_min<Real>(f1,&comm)==gmin);
   }
 
+  SECTION ("stats") {
+
+    // A second field, with different rank and no padding
+    FieldIdentifier fid2 ("field_2", {{COL,CMP,LEV},{3,2,5}}, m/s,"some_grid");
+    Field f2(fid2);
+    f2.allocate_view();
+
+    auto v1 = f1.get_view<Real**>();
+    auto v2 = f2.get_view<Real***>();
+    auto dim0 = fid.get_layout().dim(0);
+    auto dim1 = fid.get_layout().dim(1);
+    auto lsize = fid.get_layout().size();
+    auto offset = comm.rank()*lsize;
+    Kokkos::parallel_for(kt::RangePolicy(0,dim0*dim1),
+                         KOKKOS_LAMBDA(int idx) {
+      int i = idx / dim1;
+      int j = idx % dim1;
+      v1(i,j) = offset + idx + 1;
+    });
+    Kokkos::deep_copy(v2,-1.0);
+    Kokkos::fence();
+
+    // Check against the single-field utilities, locally and globally
+    for (const ekat::Comm* c : std::vector<const ekat::Comm*>{nullptr,&comm}) {
+      auto stats = field_stats<Real>({f1,f2},c);
+      REQUIRE(stats.size()==2);
+      REQUIRE(stats[0].sum==field_sum<Real>(f1,c));
+      REQUIRE(stats[0].max==field_max<Real>(f1,c));
+      REQUIRE(stats[0].min==field_min<Real>(f1,c));
+      REQUIRE(stats[0].frobenius_norm==frobenius_norm<Real>(f1,c));
+
+      const int nranks = c ? comm.size() : 1;
+      REQUIRE(stats[1].sum==-30*nranks);
+      REQUIRE(stats[1].max==-1);
+      REQUIRE(stats[1].min==-1);
+      REQUIRE(stats[1].frobenius_norm==std::sqrt(Real(30*nranks)));
+    }
+  }
+
   SECTION ("wrong_st") {
     using wrong_real =
       typename std::conditional<std::is_same<Real,double>::value,
@@ -180,6 +219,7 @@ TEST_CASE("utils") {
     REQUIRE_THROWS(field_max<int>(f1));
     REQUIRE_THROWS(field_sum<wrong_real>(f1));
     REQUIRE_THROWS(frobenius_norm<wrong_real>(f1));
+    REQUIRE_THROWS(field_stats<wrong_real>({f1}));
   }
 }
 
@@ -513,6 +513,131 @@ TEST_CASE("horizontal_remap_units", "") {
 
 } // TEST_CASE horizontal remap
 /*===================================================================================================*/
+TEST_CASE("horizontal_remap_crs", "") {
+/* Check that the CRS application of the map in apply_remap matches the application of
+ * the (target, source, weight) triplets stored in the map segments, which is how the map
+ * used to be applied.  The map is small and local to each rank, and includes a target
+ * dof with no segment, as well as a dof whose segment is added in two pieces.
+ */
+
+  using namespace scream;
+  using IPDF = std::uniform_int_distribution<int>;
+  using RPDF = std::uniform_real_distribution<Real>;
+  constexpr Real tol = std::numeric_limits<Real>::epsilon()*10;
+  auto engine = scream::setup_random_test();
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  const int num_tgt   = 8;
+  const int num_src   = 12;
+  const int num_bands = 3;
+  const int num_levs  = 2*SCREAM_PACK_SIZE+1;
+  const int empty_dof = 3;  // This target dof has no segment, and should be remapped to zero
+  const int split_dof = 5;  // This target dof has its segment added in two pieces
+
+  HorizontalMap test_map(comm,"Test CRS Map");
+  view_1d<gid_type> dof_gids("",num_tgt);
+  Kokkos::parallel_for("", num_tgt, KOKKOS_LAMBDA (const int& ii) {
+    dof_gids(ii) = ii;
+  });
+  test_map.set_dof_gids(dof_gids,0);
+
+  IPDF pdf_seg_len(1,5), pdf_src(0,num_src-1);
+  RPDF pdf_wgt(0,1);
+  auto add_segment = [&](const gid_type dof, const int len, const Real wgt_scale) {
+    HorizontalMapSegment seg(dof,len);
+    auto src_dofs_h = Kokkos::create_mirror_view(seg.get_source_dofs());
+    auto weights_h  = Kokkos::create_mirror_view(seg.get_weights());
+    Real wgt_sum = 0;
+    for (int ii=0; ii<len; ii++) {
+      src_dofs_h(ii) = pdf_src(engine);
+      weights_h(ii)  = pdf_wgt(engine);
+      wgt_sum += weights_h(ii);
+    }
+    for (int ii=0; ii<len; ii++) {
+      weights_h(ii) *= wgt_scale/wgt_sum;
+    }
+    Kokkos::deep_copy(seg.get_source_dofs(),src_dofs_h);
+    Kokkos::deep_copy(seg.get_weights(),weights_h);
+    test_map.add_remap_segment(seg);
+  };
+  for (int dof=0; dof<num_tgt; dof++) {
+    if (dof==empty_dof) {
+      continue;
+    } else if (dof==split_dof) {
+      add_segment(dof,pdf_seg_len(engine),0.25);
+      add_segment(dof,pdf_seg_len(engine),0.75);
+    } else {
+      add_segment(dof,pdf_seg_len(engine),1.0);
+    }
+  }
+  test_map.set_unique_source_dofs();
+  test_map.check();
+  REQUIRE(test_map.get_num_of_segments()==num_tgt-1);
+
+  // Random source data on the unique source dofs
+  const int num_unique = test_map.get_num_unique_dofs();
+  view_1d<Real> x_1d("",num_unique);
+  view_2d<Real> x_2d("",num_unique,num_levs);
+  view_3d<Real> x_3d("",num_unique,num_bands,num_levs);
+  RPDF pdf_data(-1,1);
+  ekat::genRandArray(x_1d,engine,pdf_data);
+  ekat::genRandArray(x_2d,engine,pdf_data);
+  ekat::genRandArray(x_3d,engine,pdf_data);
+  auto x_1d_h = Kokkos::create_mirror_view(x_1d);
+  auto x_2d_h = Kokkos::create_mirror_view(x_2d);
+  auto x_3d_h = Kokkos::create_mirror_view(x_3d);
+  Kokkos::deep_copy(x_1d_h,x_1d);
+  Kokkos::deep_copy(x_2d_h,x_2d);
+  Kokkos::deep_copy(x_3d_h,x_3d);
+
+  // Reference: apply the segment triplets one at a time on host
+  std::vector<Real> y_1d_ref(num_tgt,0);
+  std::vector<Real> y_2d_ref(num_tgt*num_levs,0);
+  std::vector<Real> y_3d_ref(num_tgt*num_bands*num_levs,0);
+  for (const auto& seg : test_map.get_map_segments()) {
+    const int  row   = seg.get_dof_idx();
+    const auto idx_h = seg.get_source_idx_on_host();
+    const auto wgt_h = seg.get_weights_on_host();
+    for (int ii=0; ii<seg.get_length(); ii++) {
+      const int col = idx_h(ii);
+      y_1d_ref[row] += x_1d_h(col)*wgt_h(ii);
+      for (int kk=0; kk<num_levs; kk++) {
+        y_2d_ref[row*num_levs+kk] += x_2d_h(col,kk)*wgt_h(ii);
+        for (int nn=0; nn<num_bands; nn++) {
+          y_3d_ref[(row*num_bands+nn)*num_levs+kk] += x_3d_h(col,nn,kk)*wgt_h(ii);
+        }
+      }
+    }
+  }
+
+  // Apply the CRS map, starting from garbage, to make sure every entry is overwritten
+  view_1d<Real> y_1d("",num_tgt);
+  view_2d<Real> y_2d("",num_tgt,num_levs);
+  view_3d<Real> y_3d("",num_tgt,num_bands,num_levs);
+  Kokkos::deep_copy(y_1d,-999);
+  Kokkos::deep_copy(y_2d,-999);
+  Kokkos::deep_copy(y_3d,-999);
+  test_map.apply_remap(x_1d,y_1d);
+  test_map.apply_remap(x_2d,y_2d);
+  test_map.apply_remap(x_3d,y_3d);
+  auto y_1d_h = Kokkos::create_mirror_view(y_1d);
+  auto y_2d_h = Kokkos::create_mirror_view(y_2d);
+  auto y_3d_h = Kokkos::create_mirror_view(y_3d);
+  Kokkos::deep_copy(y_1d_h,y_1d);
+  Kokkos::deep_copy(y_2d_h,y_2d);
+  Kokkos::deep_copy(y_3d_h,y_3d);
+  for (int ii=0; ii<num_tgt; ii++) {
+    REQUIRE(std::abs(y_1d_h(ii)-y_1d_ref[ii])<tol);
+    for (int kk=0; kk<num_levs; kk++) {
+      REQUIRE(std::abs(y_2d_h(ii,kk)-y_2d_ref[ii*num_levs+kk])<tol);
+      for (int nn=0; nn<num_bands; nn++) {
+        REQUIRE(std::abs(y_3d_h(ii,nn,kk)-y_3d_ref[(ii*num_bands+nn)*num_levs+kk])<tol);
+      }
+    }
+  }
+  REQUIRE(y_1d_h(empty_dof)==0);
+} // TEST_CASE horizontal_remap_crs
+/*===================================================================================================*/
 std::shared_ptr<GridsManager> get_test_gm(const ekat::Comm& comm, const Int num_gcols, const Int num_levs)
 {
 /* Simple routine to construct and return a grids manager given number of columns and levels */
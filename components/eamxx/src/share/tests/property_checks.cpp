@@ -5,6 +5,7 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/fused_property_checks.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
@@ -293,6 +294,51 @@ TEST_CASE("property_checks", "") {
       REQUIRE(f_data[i] == 1.0);
     }
   }
+
+  // Check that the fused pre-screening agrees with the individual checks
+  SECTION ("fused_property_checks") {
+    // A second field with the same layout, to be fused with f, and a subfield
+    FieldIdentifier fid2 ("field_2",{tags,dims}, m/s,"some_grid");
+    Field f2(fid2);
+    f2.allocate_view();
+    auto sf = f.subfield(1,1);
+
+    std::vector<std::shared_ptr<PropertyCheck>> checks = {
+      std::make_shared<FieldNaNCheck>(f,grid),
+      std::make_shared<FieldWithinIntervalCheck>(f,grid,0,1),
+      std::make_shared<FieldLowerBoundCheck>(f2,grid,0),
+      std::make_shared<FieldUpperBoundCheck>(f2,grid,1),
+      std::make_shared<FieldNaNCheck>(sf,grid)
+    };
+    FusedPropertyChecks fused;
+    fused.set_checks(checks);
+    REQUIRE (fused.num_checks()==static_cast<int>(checks.size()));
+
+    auto check_fused = [&]() {
+      const auto pass = fused.run();
+      for (size_t i=0; i<checks.size()-1; ++i) {
+        REQUIRE (pass[i]==(checks[i]->check().result==CheckResult::Pass));
+      }
+      // Checks on subfields are never fused
+      REQUIRE (not pass.back());
+    };
+
+    // All checks pass
+    randomize(f,engine,pos_pdf);
+    randomize(f2,engine,pos_pdf);
+    check_fused();
+
+    // f2 fails the lower bound check
+    f2.get_view<Real***,Host>()(0,1,2) = -1;
+    f2.sync_to_dev();
+    check_fused();
+
+    // f fails all its checks
+    f.get_view<Real***,Host>()(0,0,0) = 2;
+    f.get_view<Real***,Host>()(1,2,3) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+    check_fused();
+  }
 }
 
 } // anonymous namespace
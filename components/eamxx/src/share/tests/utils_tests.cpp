@@ -5,6 +5,11 @@
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_timing.hpp"
+#include "share/util/scream_tracing.hpp"
+
+#include <fstream>
+#include <sstream>
 
 TEST_CASE("contiguous_superset") {
   using namespace scream;
@@ -243,3 +248,62 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("tracing") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto read_trace = [&](const std::string& prefix) {
+    std::ifstream ifs(prefix + ".rank" + std::to_string(comm.rank()) + ".json");
+    REQUIRE (ifs.is_open());
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return ss.str();
+  };
+
+  const int id1 = register_timer("tracing_test::timer1");
+  const int id2 = register_timer("tracing_test::timer2");
+  REQUIRE (id1!=id2);
+  REQUIRE (register_timer("tracing_test::timer1")==id1);
+  REQUIRE (get_timer_name(id2)=="tracing_test::timer2");
+
+  SECTION ("timeline") {
+    init_tracing(comm,"tracing_test_timeline",16,false);
+    REQUIRE (is_tracing_enabled());
+    for (int step=0; step<2; ++step) {
+      trace_new_step(step);
+      start_timer(id1);
+      start_timer("tracing_test::timer3");
+      stop_timer("tracing_test::timer3");
+      start_timer("tracing_test::\"quoted\\timer\"");
+      stop_timer("tracing_test::\"quoted\\timer\"");
+      stop_timer(id1);
+    }
+    finalize_tracing();
+    REQUIRE (not is_tracing_enabled());
+
+    const auto trace = read_trace("tracing_test_timeline");
+    REQUIRE (trace.find("\"step 1\"")!=std::string::npos);
+    REQUIRE (trace.find("tracing_test::timer1")!=std::string::npos);
+    REQUIRE (trace.find("tracing_test::timer3")!=std::string::npos);
+    REQUIRE (trace.find("tracing_test::timer2")==std::string::npos);
+    // Quotes and backslashes in timer names are escaped
+    REQUIRE (trace.find("\"tracing_test::\\\"quoted\\\\timer\\\"\"")!=std::string::npos);
+    REQUIRE (trace.find("lost")==std::string::npos);
+    REQUIRE (trace.back()=='\n');
+  }
+
+  SECTION ("overflow") {
+    init_tracing(comm,"tracing_test_overflow",2,false);
+    trace_new_step(0);
+    for (int i=0; i<3; ++i) {
+      start_timer(id2);
+      stop_timer(id2);
+    }
+    finalize_tracing();
+
+    const auto trace = read_trace("tracing_test_overflow");
+    REQUIRE (trace.find("lost 4 events")!=std::string::npos);
+  }
+}
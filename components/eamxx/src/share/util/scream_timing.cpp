@@ -1,9 +1,66 @@
 #include "share/util/scream_timing.hpp"
+#include "share/util/scream_tracing.hpp"
+
+#include <ekat/ekat_assert.hpp>
 
 #include <gptl.h>
 
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace scream {
 
+namespace {
+
+// Names of the registered timers. We use a deque, so that references
+// to the stored names remain valid when new timers are registered.
+std::deque<std::string>     g_timer_names;
+std::map<std::string,int>   g_timer_ids;
+std::mutex                  g_timers_mutex;
+
+// Incremented at every GPTL finalization, to invalidate the cached handles
+int g_gptl_generation = 0;
+
+// GPTL handles are per-thread, so each thread keeps its own cache,
+// along with a pointer to the timer name (needed by GPTL on first use).
+struct TimerHandle {
+  const char* name   = nullptr;
+  void*       handle = nullptr;
+};
+
+TimerHandle& get_handle (const int id) {
+  thread_local std::vector<TimerHandle> handles;
+  thread_local int generation = 0;
+  if (generation!=g_gptl_generation) {
+    handles.clear();
+    generation = g_gptl_generation;
+  }
+  if (static_cast<int>(handles.size())<=id) {
+    handles.resize(id+1);
+  }
+  auto& h = handles[id];
+  if (h.name==nullptr) {
+    h.name = get_timer_name(id).c_str();
+  }
+  return h;
+}
+
+// Name-based calls look up the id in a per-thread cache first, so that the
+// registry (and its mutex) is only accessed the first time a thread uses a name.
+int get_timer_id (const std::string& name) {
+  thread_local std::unordered_map<std::string,int> ids;
+  auto it = ids.find(name);
+  if (it==ids.end()) {
+    it = ids.emplace(name,register_timer(name)).first;
+  }
+  return it->second;
+}
+
+} // anonymous namespace
+
 void init_gptl (bool& was_already_inited) {
 #ifdef SCREAM_CIME_BUILD
   was_already_inited = true;
@@ -14,14 +71,48 @@ void init_gptl (bool& was_already_inited) {
 }
 void finalize_gptl () {
   GPTLfinalize();
+  ++g_gptl_generation;
 }
 
 void start_timer (const std::string& name) {
-  GPTLstart(name.c_str());
+  start_timer(get_timer_id(name));
 }
 
 void stop_timer (const std::string& name) {
-  GPTLstop(name.c_str());
+  stop_timer(get_timer_id(name));
+}
+
+int register_timer (const std::string& name) {
+  std::lock_guard<std::mutex> lock(g_timers_mutex);
+  auto it = g_timer_ids.find(name);
+  if (it!=g_timer_ids.end()) {
+    return it->second;
+  }
+  const int id = g_timer_names.size();
+  g_timer_names.push_back(name);
+  g_timer_ids[name] = id;
+  return id;
+}
+
+const std::string& get_timer_name (const int id) {
+  std::lock_guard<std::mutex> lock(g_timers_mutex);
+  EKAT_REQUIRE_MSG (id>=0 && id<static_cast<int>(g_timer_names.size()),
+      "Error! Invalid timer id.\n"
+      "  - timer id: " + std::to_string(id) + "\n"
+      "  - num registered timers: " + std::to_string(g_timer_names.size()) + "\n");
+  return g_timer_names[id];
+}
+
+void start_timer (const int id) {
+  auto& h = get_handle(id);
+  GPTLstart_handle(h.name,&h.handle);
+  trace_begin(id);
+}
+
+void stop_timer (const int id) {
+  auto& h = get_handle(id);
+  trace_end(id);
+  GPTLstop_handle(h.name,&h.handle);
 }
 
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
@@ -15,6 +15,18 @@ void finalize_gptl ();
 void start_timer (const std::string& name);
 void stop_timer (const std::string& name);
 
+// Timers can also be registered once, and then started/stopped via the returned id.
+// This avoids building/hashing the timer name at every call, so it should be
+// preferred for timers that are called often (e.g., once per process per step).
+// Name-based calls look up the id in a per-thread cache, and only lock the
+// registry the first time a thread uses a given name.
+// Registering the same name twice returns the same id.
+// If tracing is enabled (see scream_tracing.hpp), timers are also recorded by the tracer.
+int register_timer (const std::string& name);
+const std::string& get_timer_name (const int id);
+void start_timer (const int id);
+void stop_timer (const int id);
+
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
 } // namespace scream
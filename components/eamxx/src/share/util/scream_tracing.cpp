@@ -0,0 +1,269 @@
+#include "share/util/scream_tracing.hpp"
+#include "share/util/scream_timing.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace scream {
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct Event {
+  double  time;   // Microseconds since init_tracing
+  int     timer_id;
+  bool    begin;
+};
+
+// A ring buffer, written only by the owning thread. The flush (which runs
+// between time steps) reads the events in [tail,head), and then sets tail=head.
+struct ThreadBuffer {
+  std::vector<Event>      events;
+  std::atomic<long long>  head{0};
+  long long               tail = 0;
+  int                     tid;
+};
+
+struct Tracer {
+  int                   rank;
+  int                   capacity;
+  clock_type::time_point t0;
+  std::ofstream         file;
+  bool                  first_event = true;
+  bool                  kokkos_hooks = false;
+  long long             num_lost = 0;
+
+  // Registration of a new thread buffer is the only operation requiring a lock
+  std::mutex                                  buffers_mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>>  buffers;
+};
+
+std::unique_ptr<Tracer> g_tracer;
+std::atomic<bool>       g_enabled{false};
+
+// Incremented at every init_tracing, to invalidate the thread buffers of previous runs
+std::atomic<int>        g_generation{0};
+
+ThreadBuffer& get_thread_buffer () {
+  thread_local ThreadBuffer* buffer = nullptr;
+  thread_local int generation = -1;
+  if (generation!=g_generation.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(g_tracer->buffers_mutex);
+    g_tracer->buffers.emplace_back(new ThreadBuffer());
+    buffer = g_tracer->buffers.back().get();
+    buffer->events.resize(g_tracer->capacity);
+    buffer->tid = g_tracer->buffers.size()-1;
+    generation = g_generation.load(std::memory_order_acquire);
+  }
+  return *buffer;
+}
+
+void record (const int timer_id, const bool begin) {
+  const auto now = clock_type::now();
+  auto& b = get_thread_buffer();
+  const auto h = b.head.load(std::memory_order_relaxed);
+  auto& e = b.events[h % b.events.size()];
+  e.time = std::chrono::duration<double,std::micro>(now-g_tracer->t0).count();
+  e.timer_id = timer_id;
+  e.begin = begin;
+  b.head.store(h+1,std::memory_order_release);
+}
+
+// Write a string as a json string literal, escaping quotes, backslashes and control chars
+void write_json_string (std::ostream& os, const std::string& s)
+{
+  os << '"';
+  for (const char c : s) {
+    if (c=='"' || c=='\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c)<0x20) {
+      char buf[8];
+      std::snprintf(buf,sizeof(buf),"\\u%04x",static_cast<unsigned>(c));
+      os << buf;
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+// Note: the closing bracket of the json array is optional in the Chrome trace format,
+//       so the file can still be loaded if the run crashes before finalize_tracing.
+void write_event (Tracer& t, const std::string& name, const char ph,
+                  const double time, const int tid)
+{
+  if (not t.first_event) {
+    t.file << ",\n";
+  }
+  t.first_event = false;
+  t.file << "{\"name\":";
+  write_json_string(t.file,name);
+  t.file << ",\"ph\":\"" << ph << "\",\"ts\":" << time
+         << ",\"pid\":" << t.rank << ",\"tid\":" << tid;
+  if (ph=='i') {
+    t.file << ",\"s\":\"p\"";
+  }
+  t.file << "}";
+}
+
+void flush () {
+  auto& t = *g_tracer;
+  std::lock_guard<std::mutex> lock(t.buffers_mutex);
+  for (auto& b : t.buffers) {
+    const auto head = b->head.load(std::memory_order_acquire);
+    auto start = b->tail;
+    if (head-start>t.capacity) {
+      t.num_lost += head-start-t.capacity;
+      start = head-t.capacity;
+    }
+    for (auto i=start; i<head; ++i) {
+      const auto& e = b->events[i % b->events.size()];
+      write_event(t,get_timer_name(e.timer_id),e.begin ? 'B' : 'E',e.time,b->tid);
+    }
+    b->tail = head;
+  }
+  t.file.flush();
+}
+
+// Kokkos profiling callbacks. The kernel id is the id of the timer with the kernel name.
+// The ids are cached per thread, keyed by the hash of the kernel name, so that a kernel
+// launch does not build the timer name, nor lock the timers registry.
+int get_kernel_timer_id (const char* name) {
+  thread_local std::unordered_multimap<std::size_t,std::pair<std::string,int>> ids;
+
+  // FNV-1a hash
+  std::size_t h = 14695981039346656037ull;
+  for (const char* c=name; *c!='\0'; ++c) {
+    h = (h ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+  }
+  const auto range = ids.equal_range(h);
+  for (auto it=range.first; it!=range.second; ++it) {
+    if (it->second.first==name) {
+      return it->second.second;
+    }
+  }
+  const int id = register_timer(std::string("Kokkos::") + name);
+  ids.emplace(h,std::make_pair(std::string(name),id));
+  return id;
+}
+
+void kokkos_begin (const char* name, const uint32_t /* dev_id */, uint64_t* kernel_id) {
+  const int id = get_kernel_timer_id(name);
+  *kernel_id = id;
+  trace_begin(id);
+}
+
+void kokkos_end (const uint64_t kernel_id) {
+  trace_end(static_cast<int>(kernel_id));
+}
+
+} // anonymous namespace
+
+void init_tracing (const ekat::Comm& comm, const std::string& fname_prefix,
+                   const int buffer_capacity, const bool kokkos_hooks)
+{
+  EKAT_REQUIRE_MSG (not is_tracing_enabled(),
+      "Error! Tracing was already initialized.\n");
+  EKAT_REQUIRE_MSG (buffer_capacity>0,
+      "Error! Invalid tracing buffer capacity.\n"
+      "  - buffer capacity: " + std::to_string(buffer_capacity) + "\n");
+
+  g_tracer.reset(new Tracer());
+  auto& t = *g_tracer;
+  t.rank = comm.rank();
+  t.capacity = buffer_capacity;
+  t.t0 = clock_type::now();
+
+  const auto fname = fname_prefix + ".rank" + std::to_string(t.rank) + ".json";
+  t.file.open(fname);
+  EKAT_REQUIRE_MSG (t.file.is_open(),
+      "Error! Could not open tracing file.\n"
+      "  - file name: " + fname + "\n");
+  t.file << "[\n";
+  t.file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << t.rank
+         << ",\"args\":{\"name\":\"rank " << t.rank << "\"}}";
+  t.first_event = false;
+
+  t.kokkos_hooks = kokkos_hooks && not Kokkos::Tools::profileLibraryLoaded();
+  if (t.kokkos_hooks) {
+    using namespace Kokkos::Tools::Experimental;
+    set_begin_parallel_for_callback(kokkos_begin);
+    set_end_parallel_for_callback(kokkos_end);
+    set_begin_parallel_reduce_callback(kokkos_begin);
+    set_end_parallel_reduce_callback(kokkos_end);
+    set_begin_parallel_scan_callback(kokkos_begin);
+    set_end_parallel_scan_callback(kokkos_end);
+  }
+
+  ++g_generation;
+  g_enabled.store(true,std::memory_order_release);
+}
+
+void finalize_tracing () {
+  if (not is_tracing_enabled()) {
+    return;
+  }
+  g_enabled.store(false,std::memory_order_release);
+
+  auto& t = *g_tracer;
+  if (t.kokkos_hooks) {
+    using namespace Kokkos::Tools::Experimental;
+    set_begin_parallel_for_callback(nullptr);
+    set_end_parallel_for_callback(nullptr);
+    set_begin_parallel_reduce_callback(nullptr);
+    set_end_parallel_reduce_callback(nullptr);
+    set_begin_parallel_scan_callback(nullptr);
+    set_end_parallel_scan_callback(nullptr);
+  }
+
+  flush();
+  if (t.num_lost>0) {
+    // Report lost events in the trace itself, so that it is not mistaken for a complete one
+    const auto time = std::chrono::duration<double,std::micro>(clock_type::now()-t.t0).count();
+    write_event(t,"lost " + std::to_string(t.num_lost) + " events (increase buffer capacity)",
+                'i',time,0);
+  }
+  t.file << "\n]\n";
+  t.file.close();
+  g_tracer = nullptr;
+}
+
+bool is_tracing_enabled () {
+  return g_enabled.load(std::memory_order_acquire);
+}
+
+void trace_begin (const int timer_id) {
+  if (is_tracing_enabled()) {
+    record(timer_id,true);
+  }
+}
+
+void trace_end (const int timer_id) {
+  if (is_tracing_enabled()) {
+    record(timer_id,false);
+  }
+}
+
+void trace_new_step (const int step) {
+  if (not is_tracing_enabled()) {
+    return;
+  }
+  flush();
+
+  auto& t = *g_tracer;
+  const auto time = std::chrono::duration<double,std::micro>(clock_type::now()-t.t0).count();
+  write_event(t,"step " + std::to_string(step),'i',time,0);
+}
+
+} // namespace scream
@@ -0,0 +1,47 @@
+#ifndef SCREAM_TRACING_HPP
+#define SCREAM_TRACING_HPP
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <string>
+
+namespace scream {
+
+/*
+ * A lightweight tracer for the timers in scream_timing.hpp
+ *
+ * GPTL only produces aggregated totals at the end of the run, which hide
+ * step-to-step variability and rank imbalance. When tracing is enabled,
+ * every start/stop of a timer is also recorded as a time-stamped event.
+ * At the beginning of each time step, the events of the previous step are
+ * appended to a per-rank file, in the Chrome trace event format (which can
+ * be loaded in chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Each thread records events in its own fixed-capacity ring buffer, so no
+ * lock is needed to record an event. If a thread records more events than
+ * the buffer capacity within one step, the oldest ones are lost.
+ *
+ * If requested, the tracer also registers Kokkos profiling callbacks, so that
+ * kernels appear in the timelines. Since kernels may run asynchronously,
+ * their events mark launch, not execution. The callbacks are not registered
+ * if a Kokkos tool library (e.g., via KOKKOS_TOOLS_LIBS) is already loaded.
+ */
+
+// Enable tracing. Events are written to <fname_prefix>.rank<N>.json.
+void init_tracing (const ekat::Comm& comm, const std::string& fname_prefix,
+                   const int buffer_capacity, const bool kokkos_hooks);
+// Write the remaining events, and close the file
+void finalize_tracing ();
+
+bool is_tracing_enabled ();
+
+// Record begin/end of a timer. These are no-ops if tracing is not enabled.
+void trace_begin (const int timer_id);
+void trace_end (const int timer_id);
+
+// Write the events recorded so far, and mark the beginning of a new step
+void trace_new_step (const int step);
+
+} // namespace scream
+
+#endif // SCREAM_TRACING_HPP
@@ -6,28 +6,26 @@
 #include "cedr_test_randomized.hpp"
 
 namespace Kokkos {
-struct ComposeReal2 {
-  cedr::Real v[2];
-  KOKKOS_INLINE_FUNCTION ComposeReal2 () { v[0] = v[1] = 0; }
+// (e'Qm_clip, e'Qm_term, e'Qm_min, e'Qm_max) accumulated in one reduction.
+struct ComposeReal4 {
+  cedr::Real v[4];
+  KOKKOS_INLINE_FUNCTION ComposeReal4 () { v[0] = v[1] = v[2] = v[3] = 0; }
 
-  KOKKOS_INLINE_FUNCTION void operator= (const ComposeReal2& s) {
-    v[0] = s.v[0];
-    v[1] = s.v[1];
+  KOKKOS_INLINE_FUNCTION void operator= (const ComposeReal4& s) {
+    for (int i = 0; i < 4; ++i) v[i] = s.v[i];
   }
-  KOKKOS_INLINE_FUNCTION void operator= (const volatile ComposeReal2& s) volatile {
-    v[0] = s.v[0];
-    v[1] = s.v[1];
+  KOKKOS_INLINE_FUNCTION void operator= (const volatile ComposeReal4& s) volatile {
+    for (int i = 0; i < 4; ++i) v[i] = s.v[i];
   }
 
-  KOKKOS_INLINE_FUNCTION ComposeReal2& operator+= (const ComposeReal2& o) {
-    v[0] += o.v[0];
-    v[1] += o.v[1];
+  KOKKOS_INLINE_FUNCTION ComposeReal4& operator+= (const ComposeReal4& o) {
+    for (int i = 0; i < 4; ++i) v[i] += o.v[i];
     return *this;
   }
 };
 
-template<> struct reduction_identity<ComposeReal2> {
-  KOKKOS_INLINE_FUNCTION static ComposeReal2 sum() { return ComposeReal2(); }
+template<> struct reduction_identity<ComposeReal4> {
+  KOKKOS_INLINE_FUNCTION static ComposeReal4 sum() { return ComposeReal4(); }
 };
 } // namespace Kokkos
 
@@ -134,14 +132,16 @@ void CAAS<ES>::reduce_locally () {
   const auto probs = o.probs_;
   const auto send = send_;
   const auto d = o.d_;
+  // The clipped mass, the mass (or previous mass, if conserving), and the
+  // bounds are accumulated in one pass over the cells of each tracer.
   if (user_reduces) {
     const Int n_accum_in_place = user_reducer_->n_accum_in_place();
     const Int nlclaccum = nlclcells / n_accum_in_place;
-    const auto calc_Qm_clip = KOKKOS_LAMBDA (const Int& j) {
+    const auto calc_Qm_sums = KOKKOS_LAMBDA (const Int& j) {
       const auto k = j / nlclaccum;
       const auto bi = j % nlclaccum;
       const auto os = (k+1)*nlclcells;
-      Real accum_clip = 0, accum_term = 0;
+      Real accum_clip = 0, accum_term = 0, accum_min = 0, accum_max = 0;
       for (Int ai = 0; ai < n_accum_in_place; ++ai) {
         const Int i = n_accum_in_place*bi + ai;
         Real Qm_clip, Qm_term;
@@ -149,54 +149,39 @@ void CAAS<ES>::reduce_locally () {
         d(os + i) = Qm_clip;
         accum_clip += Qm_clip;
         accum_term += Qm_term;
+        accum_min += d(os + nlclcells*  nt + i);
+        accum_max += d(os + nlclcells*2*nt + i);
       }
-      send(nlclaccum*      k  + bi) = accum_clip;
-      send(nlclaccum*(nt + k) + bi) = accum_term;
+      send(nlclaccum*         k  + bi) = accum_clip;
+      send(nlclaccum*(  nt + k) + bi) = accum_term;
+      send(nlclaccum*(2*nt + k) + bi) = accum_min;
+      send(nlclaccum*(3*nt + k) + bi) = accum_max;
     };
-    Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, nt*nlclaccum), calc_Qm_clip);
-    const auto set_Qm_minmax = KOKKOS_LAMBDA (const Int& j) {
-      const auto k = 2*nt + j / nlclaccum;
-      const auto bi = j % nlclaccum;
-      const auto os = (k-nt+1)*nlclcells;
-      Real accum_ext = 0;
-      for (Int ai = 0; ai < n_accum_in_place; ++ai) {
-        const Int i = n_accum_in_place*bi + ai;
-        accum_ext += d(os + i);
-      }
-      send(nlclaccum*k + bi) = accum_ext;
-    };
-    Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, 2*nt*nlclaccum), set_Qm_minmax);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, nt*nlclaccum), calc_Qm_sums);
   } else {
     using ESU = cedr::impl::ExeSpaceUtils<ES>;
-    const auto calc_Qm_clip = KOKKOS_LAMBDA (const typename ESU::Member& t) {
+    const auto calc_Qm_sums = KOKKOS_LAMBDA (const typename ESU::Member& t) {
       const auto k = t.league_rank();
       const auto os = (k+1)*nlclcells;
-      const auto reduce = [&] (const Int& i, Kokkos::ComposeReal2& accum) {
+      const auto reduce = [&] (const Int& i, Kokkos::ComposeReal4& accum) {
         Real Qm_clip, Qm_term;
         calc_Qm_scalars(d, probs, nt, nlclcells, k, os, i, Qm_clip, Qm_term);
         d(os+i) = Qm_clip;
         accum.v[0] += Qm_clip;
         accum.v[1] += Qm_term;
+        accum.v[2] += d(os + nlclcells*  nt + i);
+        accum.v[3] += d(os + nlclcells*2*nt + i);
       };
-      Kokkos::ComposeReal2 accum;
+      Kokkos::ComposeReal4 accum;
       Kokkos::parallel_reduce(Kokkos::TeamThreadRange(t, nlclcells),
-                              reduce, Kokkos::Sum<Kokkos::ComposeReal2>(accum));
-      send(     k) = accum.v[0];
-      send(nt + k) = accum.v[1];
+                              reduce, Kokkos::Sum<Kokkos::ComposeReal4>(accum));
+      send(       k) = accum.v[0];
+      send(  nt + k) = accum.v[1];
+      send(2*nt + k) = accum.v[2];
+      send(3*nt + k) = accum.v[3];
     };
     Kokkos::parallel_for(ESU::get_default_team_policy(nt, nlclcells),
-                         calc_Qm_clip);
-    const auto set_Qm_minmax = KOKKOS_LAMBDA (const typename ESU::Member& t) {
-      const auto k = 2*nt + t.league_rank();
-      const auto os = (k-nt+1)*nlclcells;
-      Real accum = 0;
-      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(t, nlclcells),
-                              [&] (const Int& i, Real& accum) { accum += d(os+i); },
-                              Kokkos::Sum<Real>(accum));
-      send(k) = accum;
-    };
-    Kokkos::parallel_for(ESU::get_default_team_policy(2*nt, nlclcells),
-                         set_Qm_minmax);
+                         calc_Qm_sums);
   }
 }
 
@@ -43,11 +43,11 @@ void CAAS::reduce_locally_horiz_omp () {
   const auto& d = o.d_;
   const Int n_accum_in_place = user_reducer_->n_accum_in_place();
   const Int nlclaccum = nlclcells / n_accum_in_place;
-  const auto calc_Qm_clip = COMPOSE_LAMBDA (const Int& j) {
+  const auto calc_Qm_sums = COMPOSE_LAMBDA (const Int& j) {
     const auto k = j / nlclaccum;
     const auto bi = j % nlclaccum;
     const auto os = (k+1)*nlclcells;
-    Real accum_clip = 0, accum_term = 0;
+    Real accum_clip = 0, accum_term = 0, accum_min = 0, accum_max = 0;
     for (Int ai = 0; ai < n_accum_in_place; ++ai) {
       const Int i = n_accum_in_place*bi + ai;
       Real Qm_clip, Qm_term;
@@ -56,23 +56,15 @@ void CAAS::reduce_locally_horiz_omp () {
       d(os + i) = Qm_clip;
       accum_clip += Qm_clip;
       accum_term += Qm_term;
+      accum_min += d(os + nlclcells*  nt + i);
+      accum_max += d(os + nlclcells*2*nt + i);
     }
-    send(nlclaccum*      k  + bi) = accum_clip;
-    send(nlclaccum*(nt + k) + bi) = accum_term;
+    send(nlclaccum*         k  + bi) = accum_clip;
+    send(nlclaccum*(  nt + k) + bi) = accum_term;
+    send(nlclaccum*(2*nt + k) + bi) = accum_min;
+    send(nlclaccum*(3*nt + k) + bi) = accum_max;
   };
-  homme_parallel_for(0, nt*nlclaccum, calc_Qm_clip);
-  const auto set_Qm_minmax = COMPOSE_LAMBDA (const Int& j) {
-    const auto k = 2*nt + j / nlclaccum;
-    const auto bi = j % nlclaccum;
-    const auto os = (k-nt+1)*nlclcells;
-    Real accum_ext = 0;
-    for (Int ai = 0; ai < n_accum_in_place; ++ai) {
-      const Int i = n_accum_in_place*bi + ai;
-      accum_ext += d(os + i);
-    }
-    send(nlclaccum*k + bi) = accum_ext;
-  };
-  homme_parallel_for(0, 2*nt*nlclaccum, set_Qm_minmax);
+  homme_parallel_for(0, nt*nlclaccum, calc_Qm_sums);
 }
 
 void CAAS::finish_locally_horiz_omp () {
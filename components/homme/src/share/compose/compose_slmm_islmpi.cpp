@@ -26,6 +26,17 @@ Request::~Request () {
 }
 #endif
 
+int start (Request* req) {
+#ifdef COMPOSE_DEBUG_MPI
+  req->unfreed++;
+#endif
+  return MPI_Start(&req->request);
+}
+
+int request_free (Request* req) {
+  return MPI_Request_free(&req->request);
+}
+
 int waitany (int count, Request* reqs, int* index, MPI_Status* stats) {
 #ifdef COMPOSE_DEBUG_MPI
   std::vector<MPI_Request> vreqs(count);
@@ -49,7 +60,8 @@ int waitall (int count, Request* reqs, MPI_Status* stats) {
                                stats ? stats : MPI_STATUS_IGNORE);
   for (int i = 0; i < count; ++i) {
     reqs[i].request = vreqs[i];
-    reqs[i].unfreed--;
+    // Inactive persistent requests are permitted and were not counted.
+    if (reqs[i].unfreed > 0) reqs[i].unfreed--;
   }
   return out;
 #else
@@ -629,7 +641,6 @@ void set_idx2_maps (IslMpi<MT>& cm, const Rank2Gids& rank2rmtgids,
   cm.x_bulkdata_offset_h = cm.x_bulkdata_offset.mirror();
   cm.sendreq.reset_capacity(i, true);
   cm.recvreq.reset_capacity(i, true);
-  cm.recvreq_ri.reset_capacity(i, true);
 
   const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
   std::vector<std::map<Int, Int> > lor2idx(nrmtrank);
@@ -753,6 +764,19 @@ void alloc_mpi_buffers (IslMpi<MT>& cm, Real* sendbuf, Real* recvbuf) {
   cm.sendbuf_meta_h = cm.sendbuf;
   cm.recvbuf_meta_h = cm.recvbuf;
 #endif
+  // The comm pattern and the buffers are now fixed, so set up the persistent
+  // receives. The count is the number of slots available, which can be larger
+  // than what is actually received in any particular message.
+  slmm_assert( ! cm.recvreq_persistent);
+  for (Int ri = 0; ri < nrmtrank; ++ri) {
+#ifdef COMPOSE_MPI_ON_HOST
+    auto&& rb = cm.recvbuf_h(ri);
+#else
+    auto&& rb = cm.recvbuf.get_h(ri);
+#endif
+    mpi::recv_init(*cm.p, rb.data(), rb.n(), cm.ranks(ri), 42, &cm.recvreq(ri));
+  }
+  cm.recvreq_persistent = true;
 #ifdef COMPOSE_HORIZ_OPENMP
   cm.ri_lidi_locks.init(nrmtrank, cm.nlid_per_rank.data());
   for (Int ri = 0; ri < nrmtrank; ++ri) {
@@ -82,6 +82,18 @@ int irecv (const Parallel& p, T* buf, int count, int src, int tag, Request* ireq
   return ret;
 }
 
+// Persistent receive. The request is inactive until start is called, and it
+// returns to the inactive state when it completes. It must eventually be freed
+// with request_free.
+template <typename T>
+int recv_init (const Parallel& p, T* buf, int count, int src, int tag,
+               Request* ireq) {
+  MPI_Datatype dt = get_type<T>();
+  return MPI_Recv_init(buf, count, dt, src, tag, p.comm(), &ireq->request);
+}
+
+int start(Request* req);
+int request_free(Request* req);
 int waitany(int count, Request* reqs, int* index, MPI_Status* stats = nullptr);
 int waitall(int count, Request* reqs, MPI_Status* stats = nullptr);
 int wait(Request* req, MPI_Status* stat = nullptr);
@@ -526,8 +538,13 @@ struct IslMpi {
   BufferLayoutArray<DDT> bla;
 
   // MPI comm data.
-  FixedCapList<mpi::Request, HDT> sendreq, recvreq;
-  FixedCapList<Int, HDT> recvreq_ri;
+  FixedCapList<mpi::Request, HDT> sendreq;
+  // Persistent receive requests, one per remote rank, created in
+  // alloc_mpi_buffers. setup_irecv starts a subset of them; nrecvreq_active is
+  // the number started and not yet waited on.
+  FixedCapList<mpi::Request, HDT> recvreq;
+  Int nrecvreq_active = 0;
+  bool recvreq_persistent = false;
   ListOfLists<Real, DDT> sendbuf, recvbuf;
 #ifdef COMPOSE_MPI_ON_HOST
   typename ListOfLists<Real, DDT>::Mirror sendbuf_h, recvbuf_h;
@@ -570,6 +587,13 @@ struct IslMpi {
   IslMpi& operator=(const IslMpi&) = delete;
 
   ~IslMpi () {
+    if (recvreq_persistent) {
+      int fin;
+      MPI_Finalized(&fin);
+      if ( ! fin)
+        for (Int ri = 0; ri < recvreq.n(); ++ri)
+          mpi::request_free(&recvreq(ri));
+    }
 #ifdef COMPOSE_HORIZ_OPENMP
     const Int nrmtrank = static_cast<Int>(ranks.n()) - 1;
     for (Int ri = 0; ri < nrmtrank; ++ri) {
@@ -630,6 +654,12 @@ template <typename MT>
 void isend(IslMpi<MT>& cm, const bool want_req = true, const bool skip_if_empty = false);
 template <typename MT>
 void recv_and_wait_on_send(IslMpi<MT>& cm);
+// Single-rank pieces of isend and recv, for use in pipelined comm patterns.
+// wait_on_recv_any waits for any started receive and returns its rank index.
+template <typename MT>
+void isend_to_rank(IslMpi<MT>& cm, const Int ri, const bool want_req = true);
+template <typename MT>
+Int wait_on_recv_any(IslMpi<MT>& cm);
 template <typename MT>
 void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty = false);
 template <typename MT>
@@ -647,6 +677,12 @@ void calc_q_extrema(IslMpi<MT>& cm, const Int& nets, const Int& nete);
 
 template <typename MT>
 void calc_rmt_q(IslMpi<MT>& cm);
+// Replaces recv_and_wait_on_send, calc_rmt_q, and isend: the departure point
+// requests from each remote rank are fulfilled, and the q data sent back, as
+// soon as they arrive, while the requests from other ranks are still in
+// flight.
+template <typename MT>
+void calc_rmt_q_pipelined(IslMpi<MT>& cm);
 template <typename MT>
 void calc_own_q(IslMpi<MT>& cm, const Int& nets, const Int& nete,
                 const DepPoints<MT>& dep_points,
@@ -43,23 +43,31 @@ void setup_irecv (IslMpi<MT>& cm, const bool skip_if_empty) {
 # pragma omp master
 #endif
   {
+    // The receives were set up once in alloc_mpi_buffers; here we just start
+    // the ones we need.
+    slmm_assert(cm.recvreq_persistent && cm.nrecvreq_active == 0);
     const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
-    cm.recvreq.clear();
-    for (Int ri = 0, nri = 0; ri < nrmtrank; ++ri) {
+    for (Int ri = 0; ri < nrmtrank; ++ri) {
       if (skip_if_empty && cm.nx_in_rank_h(ri) == 0) continue;
-      // The count is just the number of slots available, which can be larger
-      // than what is actually being received.
-      cm.recvreq_ri(nri++) = ri;
-      cm.recvreq.inc();
+      mpi::start(&cm.recvreq(ri));
+      ++cm.nrecvreq_active;
+    }
+  }
+}
+
+template <typename MT>
+void isend_to_rank (IslMpi<MT>& cm, const Int ri, const bool want_req) {
 #ifdef COMPOSE_MPI_ON_HOST
-      auto&& recvbuf = cm.recvbuf_h(ri);
+  auto&& sendbuf = cm.sendbuf_h(ri);
+  typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
+  typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+  Kokkos::deep_copy(ArrayH(sendbuf.data(), cm.sendcount_h(ri)),
+                    ArrayD(cm.sendbuf.get_h(ri).data(), cm.sendcount_h(ri)));
 #else
-      auto&& recvbuf = cm.recvbuf.get_h(ri);
+  auto&& sendbuf = cm.sendbuf.get_h(ri);
 #endif
-      mpi::irecv(*cm.p, recvbuf.data(), recvbuf.n(), cm.ranks(ri), 42,
-                 &cm.recvreq.back());
-    }
-  }
+  mpi::isend(*cm.p, sendbuf.data(), cm.sendcount_h(ri),
+             cm.ranks(ri), 42, want_req ? &cm.sendreq(ri) : nullptr);
 }
 
 template <typename MT>
@@ -72,17 +80,7 @@ void isend (IslMpi<MT>& cm, const bool want_req, const bool skip_if_empty) {
     const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
     for (Int ri = 0; ri < nrmtrank; ++ri) {
       if (skip_if_empty && cm.sendcount_h(ri) == 0) continue;
-#ifdef COMPOSE_MPI_ON_HOST
-      auto&& sendbuf = cm.sendbuf_h(ri);
-      typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
-      typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
-      Kokkos::deep_copy(ArrayH(sendbuf.data(), cm.sendcount_h(ri)),
-                        ArrayD(cm.sendbuf.get_h(ri).data(), cm.sendcount_h(ri)));
-#else
-      auto&& sendbuf = cm.sendbuf.get_h(ri);
-#endif
-      mpi::isend(*cm.p, sendbuf.data(), cm.sendcount_h(ri),
-                 cm.ranks(ri), 42, want_req ? &cm.sendreq(ri) : nullptr);
+      isend_to_rank(cm, ri, want_req);
     }
   }
 }
@@ -104,23 +102,34 @@ void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty) {
 }
 
 template <typename MT>
-void wait_on_recv (IslMpi<MT>& cm) {
+Int wait_on_recv_any (IslMpi<MT>& cm) {
+  slmm_assert(cm.nrecvreq_active > 0);
+  // Inactive persistent requests are ignored by MPI_Waitany, so we can wait on
+  // the full list. The returned index is the rank index.
+  Int ri;
+  MPI_Status stat;
+  mpi::waitany(cm.recvreq.n(), cm.recvreq.data(), &ri, &stat);
+  --cm.nrecvreq_active;
 #ifdef COMPOSE_MPI_ON_HOST
   typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
   typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
-  const int nreq = cm.recvreq.n();
-  for (Int i = 0; i < nreq; ++i) {
-    Int reqi;
-    MPI_Status stat;
-    mpi::waitany(nreq, cm.recvreq.data(), &reqi, &stat);
-    const Int ri = cm.recvreq_ri(reqi);
-    int count;
-    MPI_Get_count(&stat, mpi::get_type<Real>(), &count);
-    Kokkos::deep_copy(ArrayD(cm.recvbuf.get_h(ri).data(), count),
-                      ArrayH(cm.recvbuf_h(ri).data(), count));
-  }
+  int count;
+  MPI_Get_count(&stat, mpi::get_type<Real>(), &count);
+  Kokkos::deep_copy(ArrayD(cm.recvbuf.get_h(ri).data(), count),
+                    ArrayH(cm.recvbuf_h(ri).data(), count));
+#endif
+  return ri;
+}
+
+template <typename MT>
+void wait_on_recv (IslMpi<MT>& cm) {
+#ifdef COMPOSE_MPI_ON_HOST
+  while (cm.nrecvreq_active > 0)
+    wait_on_recv_any(cm);
 #else
-  mpi::waitall(cm.recvreq.n(), cm.recvreq.data());
+  if (cm.nrecvreq_active > 0)
+    mpi::waitall(cm.recvreq.n(), cm.recvreq.data());
+  cm.nrecvreq_active = 0;
 #endif
 }
 
@@ -156,6 +165,9 @@ template void init_mylid_with_comm_threaded(
 template void setup_irecv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
 template void isend(IslMpi<ko::MachineTraits>& cm, const bool want_req,
                     const bool skip_if_empty);
+template void isend_to_rank(IslMpi<ko::MachineTraits>& cm, const Int ri,
+                            const bool want_req);
+template Int wait_on_recv_any(IslMpi<ko::MachineTraits>& cm);
 template void recv_and_wait_on_send(IslMpi<ko::MachineTraits>& cm);
 template void wait_on_send(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
 template void recv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
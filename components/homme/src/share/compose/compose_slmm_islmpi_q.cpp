@@ -313,14 +313,17 @@ void copy_q (IslMpi<MT>& cm, const Int& nets,
   }
 }
 
+// Compute q for the entries [qe_beg, qe_end) of rmt_qs_extrema and
+// [x_beg, x_end) of rmt_xs.
 template <Int np, typename MT>
-void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
+void calc_rmt_q_pass2 (IslMpi<MT>& cm, const Int qe_beg, const Int qe_end,
+                       const Int x_beg, const Int x_end) {
   const Int qsize = cm.qsize;
 
 #ifdef HORIZ_OPENMP
 # pragma omp for
 #endif
-  for (Int it = 0; it < cm.nrmt_qs_extrema; ++it) {
+  for (Int it = qe_beg; it < qe_end; ++it) {
     const Int
       ri = cm.rmt_qs_extrema_h(4*it), lid = cm.rmt_qs_extrema_h(4*it + 1),
       lev = cm.rmt_qs_extrema_h(4*it + 2), qos = qsize*cm.rmt_qs_extrema_h(4*it + 3);  
@@ -334,7 +337,7 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
 #ifdef HORIZ_OPENMP
 # pragma omp for
 #endif
-  for (Int it = 0; it < cm.nrmt_xs; ++it) {
+  for (Int it = x_beg; it < x_end; ++it) {
     const Int
       ri = cm.rmt_xs_h(5*it), lid = cm.rmt_xs_h(5*it + 1), lev = cm.rmt_xs_h(5*it + 2),
       xos = cm.rmt_xs_h(5*it + 3), qos = qsize*cm.rmt_xs_h(5*it + 4);
@@ -466,71 +469,79 @@ struct Accum {
   }
 };
 
+// Parse the departure point requests from remote rank ri on device, appending
+// to rmt_xs and rmt_qs_extrema starting at cnt and qcnt, respectively.
 template <Int np, typename MT>
-void calc_rmt_q_pass1_scan (IslMpi<MT>& cm) {
+void calc_rmt_q_pass1_scan (IslMpi<MT>& cm, const Int ri, Int& cnt, Int& qcnt) {
   const auto& recvbuf = cm.recvbuf;
   const auto& rmt_xs = cm.rmt_xs;
   const auto& rmt_qs_extrema = cm.rmt_qs_extrema;
-  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
-  Int cnt = 0, qcnt = 0;
-  for (Int ri = 0; ri < nrmtrank; ++ri) {
-    const auto get_xos = COMPOSE_LAMBDA (const Int, Int& xos) {
-      const auto&& xs = recvbuf(ri);
-      Int nx_in_rank;
-      getbuf(xs, 0, xos, nx_in_rank);
-      if (nx_in_rank == 0) xos = 0;
-    };
-    Int xos;
-    ko::parallel_reduce(ko::RangePolicy<typename MT::DES>(0, 1), get_xos, xos);
-    if (xos == 0) {
-      cm.sendcount_h(ri) = 0;
-      continue;
+  const auto get_xos = COMPOSE_LAMBDA (const Int, Int& xos) {
+    const auto&& xs = recvbuf(ri);
+    Int nx_in_rank;
+    getbuf(xs, 0, xos, nx_in_rank);
+    if (nx_in_rank == 0) xos = 0;
+  };
+  Int xos;
+  ko::parallel_reduce(ko::RangePolicy<typename MT::DES>(0, 1), get_xos, xos);
+  if (xos == 0) {
+    cm.sendcount_h(ri) = 0;
+    return;
+  }
+  const Int cnt0 = cnt, qcnt0 = qcnt;
+  const auto f = COMPOSE_LAMBDA (const Int& idx, Accum& a, const bool fin) {
+    const auto&& xs = recvbuf(ri);
+    Int lid;
+    short lev, nx;
+    getbuf(xs, (idx + 1)*nreal_per_2int, lid, lev, nx);
+    slmm_kernel_assert(nx > 0);
+    if (fin) {
+      const auto qcnt_tot = qcnt0 + a.qcnt;
+      rmt_qs_extrema(4*qcnt_tot + 0) = ri;
+      rmt_qs_extrema(4*qcnt_tot + 1) = lid;
+      rmt_qs_extrema(4*qcnt_tot + 2) = lev;
+      rmt_qs_extrema(4*qcnt_tot + 3) = a.qos;
     }
-    const auto f = COMPOSE_LAMBDA (const Int& idx, Accum& a, const bool fin) {
-      const auto&& xs = recvbuf(ri);
-      Int lid;
-      short lev, nx;
-      getbuf(xs, (idx + 1)*nreal_per_2int, lid, lev, nx);
-      slmm_kernel_assert(nx > 0);
-      if (fin) {
-        const auto qcnt_tot = qcnt + a.qcnt;
-        rmt_qs_extrema(4*qcnt_tot + 0) = ri;
-        rmt_qs_extrema(4*qcnt_tot + 1) = lid;
-        rmt_qs_extrema(4*qcnt_tot + 2) = lev;
-        rmt_qs_extrema(4*qcnt_tot + 3) = a.qos;
+    a.qcnt += 1;
+    a.qos += 2;
+    if (fin) {
+      for (Int xi = 0; xi < nx; ++xi) {
+        const auto cnt_tot = cnt0 + a.cnt;
+        rmt_xs(5*cnt_tot + 0) = ri;
+        rmt_xs(5*cnt_tot + 1) = lid;
+        rmt_xs(5*cnt_tot + 2) = lev;
+        rmt_xs(5*cnt_tot + 3) = xos + a.xos;
+        rmt_xs(5*cnt_tot + 4) = a.qos;
+        a.cnt += 1;
+        a.xos += 3;
+        a.qos += 1;
       }
-      a.qcnt += 1;
-      a.qos += 2;
-      if (fin) {
-        for (Int xi = 0; xi < nx; ++xi) {
-          const auto cnt_tot = cnt + a.cnt;
-          rmt_xs(5*cnt_tot + 0) = ri;
-          rmt_xs(5*cnt_tot + 1) = lid;
-          rmt_xs(5*cnt_tot + 2) = lev;
-          rmt_xs(5*cnt_tot + 3) = xos + a.xos;
-          rmt_xs(5*cnt_tot + 4) = a.qos;
-          a.cnt += 1;
-          a.xos += 3;
-          a.qos += 1;
-        }
-      } else {
-        a.cnt += nx;
-        a.xos += 3*nx;
-        a.qos += nx;        
-      }
-    };
-    Accum a;
-    ko::parallel_scan(ko::RangePolicy<typename MT::DES>(0, xos/nreal_per_2int - 1), f, a);
-    cm.sendcount_h(ri) = cm.qsize*a.qos;
-    cnt += a.cnt;
-    qcnt += a.qcnt;
-  }
+    } else {
+      a.cnt += nx;
+      a.xos += 3*nx;
+      a.qos += nx;        
+    }
+  };
+  Accum a;
+  ko::parallel_scan(ko::RangePolicy<typename MT::DES>(0, xos/nreal_per_2int - 1), f, a);
+  cm.sendcount_h(ri) = cm.qsize*a.qos;
+  cnt += a.cnt;
+  qcnt += a.qcnt;
+}
+
+template <Int np, typename MT>
+void calc_rmt_q_pass1_scan (IslMpi<MT>& cm) {
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  Int cnt = 0, qcnt = 0;
+  for (Int ri = 0; ri < nrmtrank; ++ri)
+    calc_rmt_q_pass1_scan<np>(cm, ri, cnt, qcnt);
   cm.nrmt_xs = cnt;
   cm.nrmt_qs_extrema = qcnt;
 }
 
 template <Int np, typename MT>
-void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
+void calc_rmt_q_pass2 (IslMpi<MT>& cm, const Int qe_beg, const Int qe_end,
+                       const Int x_beg, const Int x_end) {
   const auto& q_src = cm.tracer_arrays->q;
   const auto& rmt_qs_extrema = cm.rmt_qs_extrema;
   const auto& rmt_xs = cm.rmt_xs;
@@ -550,7 +561,7 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
         qs(qos + 2*iq + i) = ed.q_extrema(iq, lev, i);
   };
   ko::fence();
-  ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, cm.nrmt_qs_extrema), fqe);
+  ko::parallel_for(ko::RangePolicy<typename MT::DES>(qe_beg, qe_end), fqe);
 
   const auto& s2r = cm.advecter->s2r();
   const auto& local_meshes = cm.advecter->local_meshes();
@@ -587,74 +598,80 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
       }
     }
   };
-  ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, cm.nrmt_xs), fx);
+  ko::parallel_for(ko::RangePolicy<typename MT::DES>(x_beg, x_end), fx);
   ko::fence();
 }
 
 #endif // COMPOSE_PORT
 
+// Parse the departure point requests from remote rank ri, appending to
+// rmt_xs_h and rmt_qs_extrema_h starting at cnt and qcnt, respectively.
 template <Int np, typename MT>
-void calc_rmt_q_pass1_noscan (IslMpi<MT>& cm) {
-  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+void calc_rmt_q_pass1_noscan (IslMpi<MT>& cm, const Int ri, Int& cnt, Int& qcnt) {
 #ifdef COMPOSE_PORT_SEPARATE_VIEWS
-  for (Int ri = 0; ri < nrmtrank; ++ri)
+  {
     ko::deep_copy(ko::View<Real*, typename MT::HES>(cm.recvbuf_meta_h(ri).data(), 1),
                   ko::View<Real*, typename MT::DES>(cm.recvbuf.get_h(ri).data(), 1));
-  for (Int ri = 0; ri < nrmtrank; ++ri) {
     const auto&& xs = cm.recvbuf_meta_h(ri);
     Int n, unused;
     getbuf(xs, 0, n, unused);
-    if (n == 0) continue;
-    slmm_assert(n <= cm.recvmetasz[ri]);
-    ko::deep_copy(ko::View<Real*, typename MT::HES>(cm.recvbuf_meta_h(ri).data(), n),
-                  ko::View<Real*, typename MT::DES>(cm.recvbuf.get_h(ri).data(), n));
+    if (n > 0) {
+      slmm_assert(n <= cm.recvmetasz[ri]);
+      ko::deep_copy(ko::View<Real*, typename MT::HES>(cm.recvbuf_meta_h(ri).data(), n),
+                    ko::View<Real*, typename MT::DES>(cm.recvbuf.get_h(ri).data(), n));
+    }
   }
 #endif
-  Int cnt = 0, qcnt = 0;
-  for (Int ri = 0; ri < nrmtrank; ++ri) {
-    const auto&& xs = cm.recvbuf_meta_h(ri);
-    Int mos = 0, qos = 0, nx_in_rank, xos;
-    mos += getbuf(xs, mos, xos, nx_in_rank);
-    if (nx_in_rank == 0) {
-      cm.sendcount_h(ri) = 0;
-      continue; 
-    }
-    // The upper bound is to prevent an inf loop if the msg is corrupted.
-    for (Int lidi = 0; lidi < cm.nelemd; ++lidi) {
-      Int lid, nx_in_lid;
-      mos += getbuf(xs, mos, lid, nx_in_lid);
-      for (Int levi = 0; levi < cm.nlev; ++levi) { // same re: inf loop
-        Int lev, nx;
-        mos += getbuf(xs, mos, lev, nx);
-        slmm_assert(nx > 0);
-        {
-          cm.rmt_qs_extrema_h(4*qcnt + 0) = ri;
-          cm.rmt_qs_extrema_h(4*qcnt + 1) = lid;
-          cm.rmt_qs_extrema_h(4*qcnt + 2) = lev;
-          cm.rmt_qs_extrema_h(4*qcnt + 3) = qos;
-          ++qcnt;
-          qos += 2;
-        }
-        for (Int xi = 0; xi < nx; ++xi) {
-          cm.rmt_xs_h(5*cnt + 0) = ri;
-          cm.rmt_xs_h(5*cnt + 1) = lid;
-          cm.rmt_xs_h(5*cnt + 2) = lev;
-          cm.rmt_xs_h(5*cnt + 3) = xos;
-          cm.rmt_xs_h(5*cnt + 4) = qos;
-          ++cnt;
-          xos += 3;
-          ++qos;
-        }
-        nx_in_lid -= nx;
-        nx_in_rank -= nx;
-        if (nx_in_lid == 0) break;
+  const auto&& xs = cm.recvbuf_meta_h(ri);
+  Int mos = 0, qos = 0, nx_in_rank, xos;
+  mos += getbuf(xs, mos, xos, nx_in_rank);
+  if (nx_in_rank == 0) {
+    cm.sendcount_h(ri) = 0;
+    return;
+  }
+  // The upper bound is to prevent an inf loop if the msg is corrupted.
+  for (Int lidi = 0; lidi < cm.nelemd; ++lidi) {
+    Int lid, nx_in_lid;
+    mos += getbuf(xs, mos, lid, nx_in_lid);
+    for (Int levi = 0; levi < cm.nlev; ++levi) { // same re: inf loop
+      Int lev, nx;
+      mos += getbuf(xs, mos, lev, nx);
+      slmm_assert(nx > 0);
+      {
+        cm.rmt_qs_extrema_h(4*qcnt + 0) = ri;
+        cm.rmt_qs_extrema_h(4*qcnt + 1) = lid;
+        cm.rmt_qs_extrema_h(4*qcnt + 2) = lev;
+        cm.rmt_qs_extrema_h(4*qcnt + 3) = qos;
+        ++qcnt;
+        qos += 2;
+      }
+      for (Int xi = 0; xi < nx; ++xi) {
+        cm.rmt_xs_h(5*cnt + 0) = ri;
+        cm.rmt_xs_h(5*cnt + 1) = lid;
+        cm.rmt_xs_h(5*cnt + 2) = lev;
+        cm.rmt_xs_h(5*cnt + 3) = xos;
+        cm.rmt_xs_h(5*cnt + 4) = qos;
+        ++cnt;
+        xos += 3;
+        ++qos;
       }
-      slmm_assert(nx_in_lid == 0);
-      if (nx_in_rank == 0) break;
+      nx_in_lid -= nx;
+      nx_in_rank -= nx;
+      if (nx_in_lid == 0) break;
     }
-    slmm_assert(nx_in_rank == 0);
-    cm.sendcount_h(ri) = cm.qsize*qos;
+    slmm_assert(nx_in_lid == 0);
+    if (nx_in_rank == 0) break;
   }
+  slmm_assert(nx_in_rank == 0);
+  cm.sendcount_h(ri) = cm.qsize*qos;
+}
+
+template <Int np, typename MT>
+void calc_rmt_q_pass1_noscan (IslMpi<MT>& cm) {
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  Int cnt = 0, qcnt = 0;
+  for (Int ri = 0; ri < nrmtrank; ++ri)
+    calc_rmt_q_pass1_noscan<np>(cm, ri, cnt, qcnt);
   cm.nrmt_xs = cnt;
   cm.nrmt_qs_extrema = qcnt;
   deep_copy(cm.rmt_xs, cm.rmt_xs_h);
@@ -676,7 +693,81 @@ void calc_rmt_q (IslMpi<MT>& cm) {
   { slmm::Timer t("09_rmt_q_pass1");
     calc_rmt_q_pass1<np>(cm); }
   { slmm::Timer t("09_rmt_q_pass2");
-    calc_rmt_q_pass2<np>(cm); }
+    calc_rmt_q_pass2<np>(cm, 0, cm.nrmt_qs_extrema, 0, cm.nrmt_xs); }
+}
+
+// Parse rank ri's requests and make them available to pass2.
+template <Int np, typename MT>
+void calc_rmt_q_pass1 (IslMpi<MT>& cm, const Int ri, Int& cnt, Int& qcnt) {
+#if defined COMPOSE_PORT && ! defined COMPOSE_PACK_NOSCAN
+  if (ko::OnGpu<typename MT::DES>::value) {
+    calc_rmt_q_pass1_scan<np>(cm, ri, cnt, qcnt);
+    return;
+  }
+#endif
+  const Int cnt0 = cnt, qcnt0 = qcnt;
+  calc_rmt_q_pass1_noscan<np>(cm, ri, cnt, qcnt);
+  ko::deep_copy(ko::subview(cm.rmt_xs.view(), std::make_pair(5*cnt0, 5*cnt)),
+                ko::subview(cm.rmt_xs_h.view(), std::make_pair(5*cnt0, 5*cnt)));
+  ko::deep_copy(ko::subview(cm.rmt_qs_extrema.view(), std::make_pair(4*qcnt0, 4*qcnt)),
+                ko::subview(cm.rmt_qs_extrema_h.view(), std::make_pair(4*qcnt0, 4*qcnt)));
+}
+
+// With horizontal threading, all threads call this function. The master thread
+// waits for a message and parses it, then all threads share pass2 for that
+// message's entries, then the master thread sends the result. cm.nrmt_xs and
+// cm.nrmt_qs_extrema hold the running totals, which the other threads read
+// after the barrier that follows pass1.
+template <Int np, typename MT>
+void calc_rmt_q_pipelined (IslMpi<MT>& cm) {
+#ifdef COMPOSE_HORIZ_OPENMP
+  // Make sure the receives have been started before reading their count, and
+  // that every thread has read it before the master starts to decrement it.
+# pragma omp barrier
+#endif
+  const Int nrecv = cm.nrecvreq_active;
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+# pragma omp master
+#endif
+  {
+    cm.nrmt_xs = 0;
+    cm.nrmt_qs_extrema = 0;
+  }
+  Int cnt = 0, qcnt = 0, ri = -1;
+  for (Int i = 0; i < nrecv; ++i) {
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp master
+#endif
+    {
+      { slmm::Timer t("08_recv_and_wait");
+        ri = wait_on_recv_any(cm);
+        // The send buffer for ri is still in use by the departure point request.
+        mpi::wait(&cm.sendreq(ri)); }
+      { slmm::Timer t("09_rmt_q_pass1");
+        calc_rmt_q_pass1<np>(cm, ri, cm.nrmt_xs, cm.nrmt_qs_extrema); }
+    }
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp barrier
+#endif
+    const Int cnt0 = cnt, qcnt0 = qcnt;
+    cnt = cm.nrmt_xs;
+    qcnt = cm.nrmt_qs_extrema;
+    // The work-shared loops end with a barrier, so the master can't update the
+    // totals for the next message before every thread has read them.
+    { slmm::Timer t("09_rmt_q_pass2");
+      calc_rmt_q_pass2<np>(cm, qcnt0, qcnt, cnt0, cnt); }
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp master
+#endif
+    {
+      slmm::Timer t("10_isend");
+      if (cm.sendcount_h(ri) > 0) isend_to_rank(cm, ri);
+    }
+  }
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
 }
 
 template <typename MT>
@@ -697,7 +788,16 @@ void calc_rmt_q (IslMpi<MT>& cm) {
   }
 }
 
+template <typename MT>
+void calc_rmt_q_pipelined (IslMpi<MT>& cm) {
+  switch (cm.np) {
+  case 4: calc_rmt_q_pipelined<4>(cm); break;
+  default: slmm_throw_if(true, "np " << cm.np << "not supported");
+  }
+}
+
 template void calc_rmt_q(IslMpi<ko::MachineTraits>& cm);
+template void calc_rmt_q_pipelined(IslMpi<ko::MachineTraits>& cm);
 template void calc_own_q(IslMpi<ko::MachineTraits>& cm,
                          const Int& nets, const Int& nete,
                          const DepPoints<ko::MachineTraits>& dep_points,
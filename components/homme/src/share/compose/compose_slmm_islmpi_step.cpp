@@ -52,18 +52,14 @@ void step (
   // While waiting, compute q extrema in each of my elements.
   { Timer t("07_q_extrema");
     calc_q_extrema(cm, nets, nete); }
-  // Wait for the departure point requests. Since this requires a thread
-  // barrier, at the same time make sure the send buffer is free for use.
-  { Timer t("08_recv_and_wait");
-    recv_and_wait_on_send(cm); }
-  // Compute the requested q for departure points from remotes.
-  calc_rmt_q(cm);
-  // Send q data.
-  { Timer t("10_isend");
-    isend(cm, true /* want_req */, true /* skip_if_empty */); }
+  // Fulfill each remote's departure point requests, and send the q data back,
+  // as soon as they arrive, so that computing q for one remote overlaps the
+  // messages from the others still in flight.
+  calc_rmt_q_pipelined(cm);
   // Set up to receive q for each of my departure point requests sent to
-  // remotes. We can't do this until the OpenMP barrier in isend assures that
-  // all threads are done with the receive buffer's departure points.
+  // remotes. We can't do this until the OpenMP barrier at the end of
+  // calc_rmt_q_pipelined assures that all threads are done with the receive
+  // buffer's departure points.
   { Timer t("11_setup_irecv");
     setup_irecv(cm, true /* skip_if_empty */); }
   // While waiting to get my data from remotes, compute q for departure points
@@ -292,6 +292,10 @@ struct RemapFunctor : public Remapper {
 
   TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr;
 
+  // Whether to remap all the variables of an element in a single kernel (one team
+  // per element), or to run one kernel per phase, with one team per (element,variable).
+  bool m_fused;
+
   explicit
   RemapFunctor (const int qsize,
                 const Elements& elements,
@@ -316,8 +320,17 @@ struct RemapFunctor : public Remapper {
     // Members used for sanity checks
     valid_layer_thickness = decltype(valid_layer_thickness)("Check for whether the surface thicknesses are positive",elements.num_elems());
     host_valid_input = Kokkos::create_mirror_view(valid_layer_thickness);
+
+    // The fused kernel only exposes one team per element. Use it only if that
+    // is enough to keep all the concurrent teams busy (typically, on CPU).
+    m_fused = m_state.num_elems() >= m_tu_ne_ntr.get_num_concurrent_teams();
   }
 
+  // Override the choice between the fused and the per-phase remap kernels.
+  // Both give the same results.
+  void set_fused (const bool fused) { m_fused = fused; }
+  bool is_fused () const { return m_fused; }
+
   void input_valid_assert() {
     Kokkos::deep_copy(host_valid_input, valid_layer_thickness);
     bool ok = true;
@@ -366,6 +379,9 @@ struct RemapFunctor : public Remapper {
   // Computes the intrinsic values of the states in the final map
   // i.e. momentum -> velocity
   struct ComputeIntrinsicsTag {};
+  // Does all of the above for all the states and tracers of an element,
+  // and sets dp to the target dp
+  struct ComputeFusedRemapTag {};
   // Sets dp to the target dp in the state
   struct UpdateThicknessTag {};
 
@@ -438,6 +454,54 @@ struct RemapFunctor : public Remapper {
     }
   }
 
+  // One team per element: the grids are computed once, then each state/tracer
+  // is made extrinsic (if needed), remapped, and made intrinsic again (if needed),
+  // while its data is still in cache. This avoids streaming the whole state
+  // through memory once per phase, as well as one kernel launch per phase,
+  // but it exposes ne teams rather than ne*num_to_remap().
+  // This asserts if num_to_remap() == 0
+  KOKKOS_INLINE_FUNCTION
+  void operator()(ComputeFusedRemapTag, const TeamMember &team) const {
+    KernelVariables kv(team, m_tu_ne);
+    assert(num_to_remap() != 0);
+
+    auto src_layer_thickness = m_fields_provider.get_source_thickness(kv.ie, m_data.np1);
+    auto tgt_layer_thickness = Homme::subview(m_fields_provider.m_tgt_layer_thickness, kv.ie);
+
+    m_remap.compute_grids_phase(kv, src_layer_thickness, tgt_layer_thickness);
+    kv.team_barrier();
+
+    for (int var = 0; var < num_to_remap(); ++var) {
+      const bool intrinsic = nonzero_rsplit &&
+                             var < m_fields_provider.num_states_remap() &&
+                             m_fields_provider.is_intrinsic_state(var);
+      auto remap_val = get_remap_val(kv, var);
+      if (intrinsic) {
+        compute_extrinsic_state(kv, src_layer_thickness, remap_val);
+        kv.team_barrier();
+      }
+
+      this->m_remap.compute_remap_phase(kv, remap_val);
+
+      if (intrinsic) {
+        compute_intrinsic_state(kv, tgt_layer_thickness, remap_val);
+      }
+    }
+
+    // If rsplit>0, dp3d(np1) is the source thickness, so we can only
+    // overwrite it once all the variables of this element are remapped.
+    kv.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
+                         [&](const int &loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
+                           [&](const int &ilev) {
+        m_state.m_dp3d(kv.ie,m_data.np1,igp,jgp,ilev) = tgt_layer_thickness(igp,jgp,ilev);
+      });
+    });
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(UpdateThicknessTag, const int idx) const {
     const int ie   =  idx / (NP*NP*NUM_LEV);
@@ -462,6 +526,20 @@ struct RemapFunctor : public Remapper {
     run_functor<ComputeThicknessTag>("Remap Thickness Functor",
                                      this->m_state.num_elems());
     this->input_valid_assert();
+    if (num_to_remap() > 0 && m_fused) {
+      if (nonzero_rsplit) {
+        // Pre-process the states if necessary
+        m_fields_provider.preprocess_states(m_data.np1);
+      }
+      // This also updates dp
+      run_functor<ComputeFusedRemapTag>("Remap Fused Remap Functor",
+                                        m_state.num_elems());
+      if (nonzero_rsplit) {
+        m_fields_provider.postprocess_states(m_data.np1);
+      }
+      return;
+    }
+
     if (num_to_remap() > 0) {
       // We don't want the latency of launching an empty kernel
       if (nonzero_rsplit) {
@@ -497,6 +575,20 @@ struct RemapFunctor : public Remapper {
     assert(nv <= m_data.capacity);
     const auto remap = m_remap;
     const auto tu_ne = m_tu_ne;
+    if (m_fused) {
+      // Compute the grids once per element, then remap all variables in the same team
+      const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
+        KernelVariables kv(team, tu_ne);
+        remap.compute_grids_phase(kv, Homme::subview(dp_src, kv.ie, np1),
+                                  Homme::subview(dp_tgt, kv.ie));
+        kv.team_barrier();
+        for (int iv = 0; iv < nv; ++iv) {
+          remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, iv, ALL(), ALL(), ALL()));
+        }
+      };
+      Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), r);
+      return;
+    }
     const auto g = KOKKOS_LAMBDA (const TeamMember& team) {
       KernelVariables kv(team, tu_ne);
       remap.compute_grids_phase(kv, Homme::subview(dp_src, kv.ie, np1),
@@ -523,6 +615,20 @@ struct RemapFunctor : public Remapper {
     assert(nv <= m_data.capacity);
     const auto remap = m_remap;
     const auto tu_ne = m_tu_ne;
+    if (m_fused) {
+      // Compute the grids once per element, then remap all variables in the same team
+      const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
+        KernelVariables kv(team, tu_ne);
+        remap.compute_grids_phase(kv, Homme::subview(dp_src, kv.ie),
+                                  Homme::subview(dp_tgt, kv.ie, np1));
+        kv.team_barrier();
+        for (int iv = 0; iv < nv; ++iv) {
+          remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, n_v, iv, ALL(), ALL(), ALL()));
+        }
+      };
+      Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), r);
+      return;
+    }
     const auto g = KOKKOS_LAMBDA (const TeamMember& team) {
       KernelVariables kv(team, tu_ne);
       remap.compute_grids_phase(kv, Homme::subview(dp_src, kv.ie),
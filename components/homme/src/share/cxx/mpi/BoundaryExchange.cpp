@@ -51,6 +51,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_interior_pack_pending = false;
 }
 
 BoundaryExchange::BoundaryExchange(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager)
@@ -292,6 +293,80 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
   recv_and_unpack (rspheremp);
 }
 
+void BoundaryExchange::exchange_start ()
+{
+  tstart("be exchange_start");
+  // Check that the registration has completed first
+  assert (m_registration_completed);
+
+  // Check that this object is setup to perform exchange and not exchange_min_max
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  // Same as in exchange
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // Check that buffers are not locked by someone else, then lock them
+  assert (!m_buffers_manager->are_buffers_busy());
+  m_buffers_manager->lock_buffers();
+
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  if ( ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  m_recv_pending = true;
+
+  // Only boundary elements have shared connections, so packing them fills
+  // all the MPI send buffers, and we can already start sending.
+  const int nbe = m_connectivity->get_num_boundary_elements();
+  const int nbc = m_connectivity->get_num_boundary_connections();
+  pack_elements(Kokkos::subview(m_connectivity->get_d_elem_order(), std::make_pair(0,nbe)),
+                Kokkos::subview(m_connectivity->get_d_conn_order(), std::make_pair(0,nbc)));
+  Kokkos::fence();
+
+  send();
+  m_interior_pack_pending = true;
+  tstop("be exchange_start");
+}
+
+void BoundaryExchange::exchange_finish () {
+  exchange_finish(nullptr);
+}
+
+void BoundaryExchange::exchange_finish (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  exchange_finish(&rspheremp);
+}
+
+void BoundaryExchange::exchange_finish (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  tstart("be exchange_finish");
+  // Same as in exchange
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // Don't call finish without a start
+  assert (m_interior_pack_pending);
+
+  // Interior elements only have local connections, so their data only goes
+  // in the local buffer, which is not read until the unpack phase.
+  const int nbe = m_connectivity->get_num_boundary_elements();
+  const int nbc = m_connectivity->get_num_boundary_connections();
+  const int ne  = m_connectivity->get_num_local_elements();
+  const int nc  = m_connectivity->get_d_conn_order().extent_int(0);
+  pack_elements(Kokkos::subview(m_connectivity->get_d_elem_order(), std::make_pair(nbe,ne)),
+                Kokkos::subview(m_connectivity->get_d_conn_order(), std::make_pair(nbc,nc)));
+  Kokkos::fence();
+  m_interior_pack_pending = false;
+
+  recv_and_unpack(rspheremp);
+  tstop("be exchange_finish");
+}
+
 void BoundaryExchange::exchange_min_max ()
 {
   // Check that the registration has completed first
@@ -329,13 +404,15 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const ExecViewUnmanaged<const int*> elems,
+      const ExecViewUnmanaged<const int*> conns,
+      const int num_2d_fields) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
-  const int nconn = ucon.extent_int(0);
+  const int nconn = conns.extent_int(0);
   Kokkos::parallel_for(
     Kokkos::RangePolicy<ExecSpace>(0, num_2d_fields*nconn),
     KOKKOS_LAMBDA(const int it) {
-      const int iconn = it / num_2d_fields;
+      const int iconn = conns(it / num_2d_fields);
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
@@ -355,7 +432,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const ExecViewUnmanaged<const int*> elems,
+      const ExecViewUnmanaged<const int*> conns,
+      const int num_3d_fields,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -363,7 +442,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
   if (partial_column) nlev_packs = *nlev_packs_;
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
-    const int nconn = ucon.extent_int(0);
+    const int nconn = conns.extent_int(0);
     Kokkos::parallel_for(
       Kokkos::RangePolicy<ExecSpace>(0, num_3d_fields*nconn*NUM_LEV_PACKS),
       KOKKOS_LAMBDA(const int it) {
@@ -373,7 +452,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
           if (ilev >= nlev_packs(ifield))
             return;
         }
-        const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
+        const int iconn = conns(it / (num_3d_fields*NUM_LEV_PACKS));
         const auto& info = ucon(iconn);
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
@@ -385,7 +464,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
           sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
       });
   } else {
-    const auto num_parallel_iterations = num_elems*num_3d_fields;
+    const auto num_parallel_iterations = elems.extent_int(0)*num_3d_fields;
     ThreadPreferences tp;
     tp.max_threads_usable = NP;
     tp.max_vectors_usable = NUM_LEV_PACKS;
@@ -398,7 +477,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
     Kokkos::parallel_for(policy,
       KOKKOS_LAMBDA(const TeamMember& team) {
         Homme::KernelVariables kv(team, num_3d_fields);
-        const int ie = kv.ie;
+        const int ie = elems(kv.ie);
         const int ifield = kv.iq;
         const auto tvr = Kokkos::ThreadVectorRange(
           kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
@@ -454,28 +533,44 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
+  pack_elements(m_connectivity->get_d_elem_order(), m_connectivity->get_d_conn_order());
+  Kokkos::fence();
+
+  // ---- Send ---- //
+  send();
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack_elements (const ExecViewUnmanaged<const int*> elems,
+                                      const ExecViewUnmanaged<const int*> conns)
+{
+  if (elems.extent_int(0) == 0) {
+    return;
+  }
+
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
   // First, pack 2d fields (if any)...
   if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, elems, conns,
          m_num_2d_fields);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
       pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+                          elems, conns, m_num_3d_fields, &m_3d_nlev_pack_d);
     else
       pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+                    elems, conns, m_num_3d_fields);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
     pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
-  Kokkos::fence();
+                    elems, conns, m_num_3d_int_fields);
+}
 
-  // ---- Send ---- //
+void BoundaryExchange::send ()
+{
   tstart("be sync_send_buffer");
   m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
   tstop("be sync_send_buffer");
@@ -483,10 +578,10 @@ void BoundaryExchange::pack_and_send ()
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
                             m_connectivity->get_comm().mpi_comm());
+  tstop("be send");
 
   // Notify a send is ongoing
   m_send_pending = true;
-  tstop("be pack_and_send");
 }
 
 void BoundaryExchange::recv_and_unpack () {
@@ -192,9 +192,23 @@ public:
   void exchange ();
   void exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
+  // Split-phase version of exchange, to overlap communication with computation.
+  // exchange_start packs the data of the boundary elements (the elements with
+  // connections to remote processes, see Connectivity::get_d_elem_order), and
+  // starts the MPI sends/recvs. Hence, when calling exchange_start, only the
+  // registered fields on boundary elements need to be up to date.
+  // exchange_finish packs the interior elements, then waits for the messages
+  // and unpacks all the elements. Between the two calls, the user can compute
+  // the fields on interior elements, while MPI messages are in flight.
+  void exchange_start ();
+  void exchange_finish ();
+  void exchange_finish (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
   // Exchange all registered 1d fields, performing min/max operations with neighbors
   void exchange_min_max ();
 
+  std::shared_ptr<const Connectivity> get_connectivity () const { return m_connectivity; }
+
   // Get the number of 2d/3d fields that this object handles
   int get_num_1d_fields () const { return m_num_1d_fields; }
   int get_num_2d_fields () const { return m_num_2d_fields; }
@@ -236,6 +250,12 @@ private:
 
   void build_buffer_views_and_requests ();
 
+  // Pack the registered fields on the given elements (and their connections)
+  void pack_elements (const ExecViewUnmanaged<const int*> elems,
+                      const ExecViewUnmanaged<const int*> conns);
+  // Sync the send buffer, and start the sends
+  void send ();
+
   std::shared_ptr<Connectivity>   m_connectivity;
 
   int                       m_elem_buf_size[2];
@@ -293,6 +313,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_interior_pack_pending;
 
   int         m_num_elems;
 
@@ -302,6 +323,7 @@ private:
   void free_requests();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void exchange_finish(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
   void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 };
@@ -9,6 +9,7 @@
 
 #include <array>
 #include <algorithm>
+#include <vector>
 
 namespace Homme
 {
@@ -18,6 +19,8 @@ Connectivity::Connectivity ()
  , m_initialized  (false)
  , m_num_local_elements (-1)
  , m_max_corner_elements(-1)
+ , m_num_boundary_elements(0)
+ , m_num_boundary_connections(0)
 {
   // Nothing to be done here
 }
@@ -136,6 +139,7 @@ void Connectivity::finalize(const bool sanity_check)
   }
 
   setup_ucon();
+  setup_elem_order();
 
   m_finalized = true;
 }
@@ -313,6 +317,47 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::setup_elem_order () {
+  const int nconn = h_ucon.extent_int(0);
+
+  d_elem_order = decltype(d_elem_order)("Element order", m_num_local_elements);
+  h_elem_order = Kokkos::create_mirror_view(d_elem_order);
+  d_conn_order = decltype(d_conn_order)("Connection order", nconn);
+  h_conn_order = Kokkos::create_mirror_view(d_conn_order);
+
+  // An element is a boundary element if at least one of its connections is
+  // shared with another process. Keep the original (lid) order within each group.
+  std::vector<int> boundary, interior;
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool is_boundary = false;
+    if (nconn > 0) {
+      for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k)
+        is_boundary = is_boundary || h_ucon(k).sharing == etoi(ConnectionSharing::SHARED);
+    }
+    (is_boundary ? boundary : interior).push_back(ie);
+  }
+  m_num_boundary_elements = boundary.size();
+
+  int pos = 0, conn_pos = 0;
+  const auto append = [&] (const std::vector<int>& elems) {
+    for (const int ie : elems) {
+      h_elem_order(pos++) = ie;
+      if (nconn > 0) {
+        for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k)
+          h_conn_order(conn_pos++) = k;
+      }
+    }
+  };
+  append(boundary);
+  m_num_boundary_connections = conn_pos;
+  append(interior);
+  assert(pos == m_num_local_elements);
+  assert(conn_pos == nconn);
+
+  Kokkos::deep_copy(d_elem_order, h_elem_order);
+  Kokkos::deep_copy(d_conn_order, h_conn_order);
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
@@ -322,6 +367,12 @@ void Connectivity::clean_up()
   h_ucon = decltype(h_ucon)("", 0);
   d_ucon_ptr = decltype(d_ucon_ptr)("", 0);
   h_ucon_ptr = decltype(h_ucon_ptr)("", 0);
+  d_elem_order = decltype(d_elem_order)("", 0);
+  h_elem_order = decltype(h_elem_order)("", 0);
+  d_conn_order = decltype(d_conn_order)("", 0);
+  h_conn_order = decltype(h_conn_order)("", 0);
+  m_num_boundary_elements = 0;
+  m_num_boundary_connections = 0;
 
   m_initialized = false;
   m_finalized   = false;
@@ -100,6 +100,23 @@ public:
   HostViewUnmanaged<const ConnectionInfo*> get_h_ucon () const { return h_ucon; }
   HostViewUnmanaged<const int*> get_h_ucon_ptr () const { return h_ucon_ptr; }
 
+  // Element ordering separating elements with at least one shared connection
+  // ("boundary" elements) from elements with only local connections
+  // ("interior" elements). The first get_num_boundary_elements() entries of
+  // elem_order are the local IDs of the boundary elements, the remaining ones
+  // those of the interior elements. Likewise, conn_order lists the indices
+  // in ucon of the connections of boundary elements first, then those of
+  // interior elements. This allows to pack (and send) the data of boundary
+  // elements before the interior elements have been computed.
+  ExecViewUnmanaged<const int*> get_d_elem_order () const { return d_elem_order; }
+  HostViewUnmanaged<const int*> get_h_elem_order () const { return h_elem_order; }
+  ExecViewUnmanaged<const int*> get_d_conn_order () const { return d_conn_order; }
+  HostViewUnmanaged<const int*> get_h_conn_order () const { return h_conn_order; }
+
+  int get_num_boundary_elements    () const { return m_num_boundary_elements; }
+  int get_num_interior_elements    () const { return m_num_local_elements - m_num_boundary_elements; }
+  int get_num_boundary_connections () const { return m_num_boundary_connections; }
+
   // Get number of connections with given kind and sharing
   template<typename MemSpace>
   KOKKOS_INLINE_FUNCTION
@@ -156,6 +173,12 @@ private:
   ExecViewManaged<int*>::HostMirror h_ucon_ptr;
   ExecViewManaged<int*>             d_ucon_dir_ptr;
   ExecViewManaged<int*>::HostMirror h_ucon_dir_ptr;
+  // Boundary elements (and their connections) first, then interior ones
+  ExecViewManaged<int*>             d_elem_order;
+  ExecViewManaged<int*>::HostMirror h_elem_order;
+  ExecViewManaged<int*>             d_conn_order;
+  ExecViewManaged<int*>::HostMirror h_conn_order;
+  int     m_num_boundary_elements, m_num_boundary_connections;
   // Helper used to accumulated connections during add_connection phase. Emptied
   // in finalize. l_ is local; r_ is remote.
   struct UConInfo {
@@ -167,6 +190,8 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // In finalize call, after setup_ucon, split elements in boundary/interior.
+  void setup_elem_order();
 };
 
 } // namespace Homme
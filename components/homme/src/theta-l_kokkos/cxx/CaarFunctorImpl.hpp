@@ -121,6 +121,13 @@ struct CaarFunctorImpl {
 
   TeamUtils<ExecSpace> m_tu;
 
+  // The pre-exchange loop is split in two launches, one on the elements with
+  // remote connections, and one on the remaining ones, so that the boundary
+  // exchange can start before the latter are computed. Teams process element
+  // m_elem_order(m_elem_offset+league_rank) (see Connectivity::get_d_elem_order).
+  ExecViewUnmanaged<const int*>    m_elem_order;
+  int                              m_elem_offset;
+
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
   CaarFunctorImpl(const Elements &elements, const Tracers &/* tracers */,
@@ -140,6 +147,7 @@ struct CaarFunctorImpl {
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,m_num_elems*NP*NP)
       , m_tu(m_policy_pre)
+      , m_elem_offset(0)
   {
     // Initialize equation of state
     m_eos.init(params.theta_hydrostatic_mode,m_hvcoord);
@@ -157,6 +165,7 @@ struct CaarFunctorImpl {
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
+      , m_elem_offset(0)
   {}
 
   void setup (const Elements &elements, const Tracers &/*tracers*/,
@@ -333,6 +342,14 @@ struct CaarFunctorImpl {
     m_scale2g_last_int_pack[ColInfo<NUM_INTERFACE_LEV>::LastPackEnd] = m_data.scale1*g;
   }
 
+  // Same team configuration as m_policy_pre (which m_tu is built for), on a subset of elements
+  TeamPolicyType<TagPreExchange> pre_exchange_policy (const int num_elems) const {
+    TeamPolicyType<TagPreExchange> policy(num_elems, m_policy_pre.team_size(),
+                                          m_policy_pre.impl_vector_length());
+    policy.set_chunk_size(1);
+    return policy;
+  }
+
   void run (const RKStageData& data)
   {
 
@@ -342,16 +359,39 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
+    const auto& connectivity = *m_bes[data.np1]->get_connectivity();
+    const int num_boundary_elems = connectivity.get_num_boundary_elements();
+    const int num_interior_elems = connectivity.get_num_interior_elements();
+    m_elem_order = connectivity.get_d_elem_order();
+
+    // Compute boundary elements first, then start the exchange, so that
+    // MPI messages are in flight while we compute the interior elements.
+    GPTLstart("caar compute");
+    int nerr_boundary = 0;
+    m_elem_offset = 0;
+    if (num_boundary_elems > 0)
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (boundary elems)",
+                              pre_exchange_policy(num_boundary_elems), *this, nerr_boundary);
+    Kokkos::fence();
+    GPTLstop("caar compute");
+
+    GPTLstart("caar_bexchV");
+    m_bes[data.np1]->exchange_start();
+    GPTLstop("caar_bexchV");
+
     GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+    int nerr_interior = 0;
+    m_elem_offset = num_boundary_elems;
+    if (num_interior_elems > 0)
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (interior elems)",
+                              pre_exchange_policy(num_interior_elems), *this, nerr_interior);
     Kokkos::fence();
     GPTLstop("caar compute");
-    if (nerr > 0)
+    if (nerr_boundary + nerr_interior > 0)
       check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
 
     GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+    m_bes[data.np1]->exchange_finish(m_geometry.m_rspheremp);
     Kokkos::fence();
     GPTLstop("caar_bexchV");
 
@@ -373,6 +413,7 @@ struct CaarFunctorImpl {
     // Note: make sure the same temp is not used within each epoch!
 
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elem_order(m_elem_offset + kv.ie);
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
@@ -145,8 +145,11 @@ void zoltan_partition_problem(
   Zoltan2::XpetraMultiVectorAdapter<tMVector_t> *adapter = (new Zoltan2::XpetraMultiVectorAdapter<tMVector_t>(const_coords));
 
   ia->setCoordinateInput(adapter);
-  ia->setEdgeWeights(adjwgt, 1, 0);
-  ia->setVertexWeights(vwgt, 1, 0);
+  // adjwgt and vwgt are given for the global graph, but the adapter wants
+  // the weights of this rank's rows only.
+  const zgno_t myEdgeBegin = numMyElements > 0 ? xadj[myBegin] : 0;
+  ia->setEdgeWeights(adjwgt + myEdgeBegin, 1, 0);
+  ia->setVertexWeights(vwgt + (numMyElements > 0 ? myBegin : 0), 1, 0);
   /***********************************SET COORDINATES*********************/
 
 
@@ -345,8 +348,11 @@ void zoltan_map_problem(
   Zoltan2::XpetraMultiVectorAdapter<tMVector_t> *adapter = (new Zoltan2::XpetraMultiVectorAdapter<tMVector_t>(const_coords));
 
   ia->setCoordinateInput(adapter);
-  ia->setEdgeWeights(adjwgt, 1, 0);
-  ia->setVertexWeights(vwgt, 1, 0);
+  // adjwgt and vwgt are given for the global graph, but the adapter wants
+  // the weights of this rank's rows only.
+  const zgno_t myEdgeBegin = numMyElements > 0 ? xadj[myBegin] : 0;
+  ia->setEdgeWeights(adjwgt + myEdgeBegin, 1, 0);
+  ia->setVertexWeights(vwgt + (numMyElements > 0 ? myBegin : 0), 1, 0);
 
   env->timerStop(Zoltan2::MACRO_TIMERS, "AdapterCreate");
   /***********************************SET COORDINATES*********************/
@@ -505,8 +511,11 @@ void zoltan_mapping_problem(
   Zoltan2::XpetraMultiVectorAdapter<tMVector_t> *adapter = (new Zoltan2::XpetraMultiVectorAdapter<tMVector_t>(const_coords));
 
   ia->setCoordinateInput(adapter);
-  ia->setEdgeWeights(adjwgt, 1, 0);
-  ia->setVertexWeights(vwgt, 1, 0);
+  // adjwgt and vwgt are given for the global graph, but the adapter wants
+  // the weights of this rank's rows only.
+  const zgno_t myEdgeBegin = numMyElements > 0 ? xadj[myBegin] : 0;
+  ia->setEdgeWeights(adjwgt + myEdgeBegin, 1, 0);
+  ia->setVertexWeights(vwgt + (numMyElements > 0 ? myBegin : 0), 1, 0);
 
   env->timerStop(Zoltan2::MACRO_TIMERS, "AdapterCreate");
   /***********************************SET COORDINATES*********************/
@@ -767,7 +776,7 @@ void zoltan2_print_metrics2(
   RCP<tcrsGraph_t> TpetraCrsGraph(new tcrsGraph_t (map, 0));
 
   const zlno_t numMyElements = map->getNodeNumElements ();
-  //const zgno_t myBegin = map->getGlobalElement (0);
+  const zgno_t myBegin = map->getGlobalElement (0);
 
   for (zlno_t lclRow = 0; lclRow < numMyElements; ++lclRow) {
     const zgno_t gblRow = map->getGlobalElement (lclRow);
@@ -786,8 +795,11 @@ void zoltan2_print_metrics2(
   RCP<adapter_t> ia (new adapter_t(const_data/*,(int)vtx_weights.size(),(int)edge_weights.size()*/, 1, 1));
 
   /***********************************SET COORDINATES*********************/
-  ia->setEdgeWeights(adjwgt, 1, 0);
-  ia->setVertexWeights(vwgt, 1, 0);
+  // adjwgt and vwgt are given for the global graph, but the adapter wants
+  // the weights of this rank's rows only.
+  const zgno_t myEdgeBegin = numMyElements > 0 ? xadj[myBegin] : 0;
+  ia->setEdgeWeights(adjwgt + myEdgeBegin, 1, 0);
+  ia->setVertexWeights(vwgt + (numMyElements > 0 ? myBegin : 0), 1, 0);
   env->timerStop(Zoltan2::MACRO_TIMERS, "AdapterCreate");
   /***********************************SET COORDINATES*********************/
 
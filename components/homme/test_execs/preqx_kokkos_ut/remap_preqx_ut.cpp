@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 
+#include <cmath>
 #include <limits>
 
 #include "RemapFunctor.hpp"
@@ -82,4 +83,68 @@ TEST_CASE("remap_interface", "vertical remap") {
     RF remap(qsize, elements, tracers, hvcoord);
     REQUIRE_NOTHROW(remap.run_remap(np1, n0_qdp, dt));
   }
+  SECTION("fused_vs_unfused") {
+    constexpr bool rsplit_non_zero = true;
+    constexpr int qsize = QSIZE_D;
+    using RF = RemapFunctor<rsplit_non_zero, PpmVertRemap<PpmMirrored>>;
+
+    // Save the initial state, so that both versions remap the same input
+    auto& state = elements.m_state;
+    auto v0    = Kokkos::create_mirror_view(state.m_v);
+    auto t0    = Kokkos::create_mirror_view(state.m_t);
+    auto dp0   = Kokkos::create_mirror_view(state.m_dp3d);
+    auto ps0   = Kokkos::create_mirror_view(state.m_ps_v);
+    auto qdp0  = Kokkos::create_mirror_view(tracers.qdp);
+    Kokkos::deep_copy(v0,state.m_v);
+    Kokkos::deep_copy(t0,state.m_t);
+    Kokkos::deep_copy(dp0,state.m_dp3d);
+    Kokkos::deep_copy(ps0,state.m_ps_v);
+    Kokkos::deep_copy(qdp0,tracers.qdp);
+
+    RF remap(qsize, elements, tracers, hvcoord);
+    remap.set_fused(false);
+    remap.run_remap(np1, n0_qdp, dt);
+
+    auto v_unfused   = Kokkos::create_mirror_view(state.m_v);
+    auto t_unfused   = Kokkos::create_mirror_view(state.m_t);
+    auto dp_unfused  = Kokkos::create_mirror_view(state.m_dp3d);
+    auto qdp_unfused = Kokkos::create_mirror_view(tracers.qdp);
+    Kokkos::deep_copy(v_unfused,state.m_v);
+    Kokkos::deep_copy(t_unfused,state.m_t);
+    Kokkos::deep_copy(dp_unfused,state.m_dp3d);
+    Kokkos::deep_copy(qdp_unfused,tracers.qdp);
+
+    Kokkos::deep_copy(state.m_v,v0);
+    Kokkos::deep_copy(state.m_t,t0);
+    Kokkos::deep_copy(state.m_dp3d,dp0);
+    Kokkos::deep_copy(state.m_ps_v,ps0);
+    Kokkos::deep_copy(tracers.qdp,qdp0);
+
+    remap.set_fused(true);
+    remap.run_remap(np1, n0_qdp, dt);
+
+    auto v_fused   = Kokkos::create_mirror_view(state.m_v);
+    auto t_fused   = Kokkos::create_mirror_view(state.m_t);
+    auto dp_fused  = Kokkos::create_mirror_view(state.m_dp3d);
+    auto qdp_fused = Kokkos::create_mirror_view(tracers.qdp);
+    Kokkos::deep_copy(v_fused,state.m_v);
+    Kokkos::deep_copy(t_fused,state.m_t);
+    Kokkos::deep_copy(dp_fused,state.m_dp3d);
+    Kokkos::deep_copy(qdp_fused,tracers.qdp);
+
+    // The two versions run the same operations on each variable, so they must be bfb
+    auto compare = [](const Scalar* a, const Scalar* b, const size_t size) {
+      const Real* ra = reinterpret_cast<const Real*>(a);
+      const Real* rb = reinterpret_cast<const Real*>(b);
+      for (size_t i=0; i<size*VECTOR_SIZE; ++i) {
+        // Skip padding, which may be NaN
+        if (std::isnan(ra[i]) && std::isnan(rb[i])) continue;
+        REQUIRE (ra[i]==rb[i]);
+      }
+    };
+    compare(v_fused.data(),v_unfused.data(),v_fused.size());
+    compare(t_fused.data(),t_unfused.data(),t_fused.size());
+    compare(dp_fused.data(),dp_unfused.data(),dp_fused.size());
+    compare(qdp_fused.data(),qdp_unfused.data(),qdp_fused.size());
+  }
 }
@@ -212,8 +212,9 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be3->pack_and_send_min_max();
       be1->pack_and_send();
       be1->recv_and_unpack();
-      be2->pack_and_send();
-      be2->recv_and_unpack();
+      // Split-phase exchange, packing boundary elements first
+      be2->exchange_start();
+      be2->exchange_finish();
       be3->recv_and_unpack_min_max();
     }
     Kokkos::deep_copy(field_1d_cxx_host,     field_1d_cxx);
@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+
+#include "zoltan_cppinterface.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// =========================== TESTS ============================ //
+
+namespace {
+
+// Periodic n x n grid of elements, each connected to its 4 neighbors, in the
+// CSR format that genzoltanpart passes to zoltan_partition_problem.
+struct Grid {
+  int n, nelem;
+  std::vector<int> xadj, adjncy;
+  std::vector<double> adjwgt, xcoord, ycoord, zcoord;
+
+  Grid (const int n_) : n(n_), nelem(n_*n_) {
+    xadj.push_back(0);
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i) {
+        for (const auto& d : {std::make_pair(-1,0), std::make_pair(1,0),
+                              std::make_pair(0,-1), std::make_pair(0,1)})
+          adjncy.push_back(((j + d.second + n) % n)*n + (i + d.first + n) % n);
+        xadj.push_back(adjncy.size());
+        xcoord.push_back(i + 0.5);
+        ycoord.push_back(j + 0.5);
+        zcoord.push_back(0);
+      }
+    adjwgt.resize(adjncy.size(), 1);
+  }
+};
+
+// Partition the grid with RCB, balancing vwgt, and return the resulting
+// 1-based part of each element.
+std::vector<int> partition (Grid& g, std::vector<double> vwgt, int nparts) {
+  int partmethod = 6, mapmethod = 1, coord_dimension = 2;
+  std::vector<int> parts(g.nelem, 0);
+  zoltan_partition_problem(&g.nelem, g.xadj.data(), g.adjncy.data(), g.adjwgt.data(),
+                           vwgt.data(), &nparts, MPI_COMM_WORLD,
+                           g.xcoord.data(), g.ycoord.data(), g.zcoord.data(),
+                           &coord_dimension, parts.data(), &partmethod, &mapmethod);
+  return parts;
+}
+
+// Max over parts of the part's cost, divided by the average.
+double imbalance (const std::vector<int>& parts, const std::vector<double>& cost,
+                  const int nparts) {
+  std::vector<double> part_cost(nparts, 0);
+  double total = 0;
+  for (size_t i = 0; i < parts.size(); ++i) {
+    REQUIRE(parts[i] >= 1);
+    REQUIRE(parts[i] <= nparts);
+    part_cost[parts[i]-1] += cost[i];
+    total += cost[i];
+  }
+  return *std::max_element(part_cost.begin(), part_cost.end())*nparts/total;
+}
+
+} // anonymous namespace
+
+TEST_CASE ("Zoltan2 weighted partition",
+           "Per-element costs passed as vertex weights reduce the load imbalance")
+{
+  int nparts;
+  MPI_Comm_size(MPI_COMM_WORLD, &nparts);
+
+  Grid g(16);
+
+  // Synthetic costs: a cloudy band, a quarter of the grid wide, where the
+  // physics is 8 times more expensive than in the clear region.
+  std::vector<double> cost(g.nelem);
+  for (int i = 0; i < g.nelem; ++i)
+    cost[i] = g.xcoord[i] < g.n/4 ? 8 : 1;
+
+  const auto parts_unweighted = partition(g, std::vector<double>(g.nelem, 1), nparts);
+  const auto parts_weighted = partition(g, cost, nparts);
+
+  // Every rank gets the same, complete partition.
+  for (const auto& parts : {parts_unweighted, parts_weighted}) {
+    std::vector<int> parts_root(parts);
+    MPI_Bcast(parts_root.data(), g.nelem, MPI_INT, 0, MPI_COMM_WORLD);
+    REQUIRE(parts == parts_root);
+  }
+
+  const double imb_unweighted = imbalance(parts_unweighted, cost, nparts);
+  const double imb_weighted = imbalance(parts_weighted, cost, nparts);
+  if (nparts == 1) {
+    REQUIRE(imb_weighted == 1);
+  } else {
+    // Ignoring the costs puts the cloudy band in a few parts.
+    REQUIRE(imb_weighted < imb_unweighted);
+    // RCB cuts between rows or columns of elements, so the parts can't be
+    // balanced to better than one column of the cloudy band.
+    REQUIRE(imb_weighted < 1 + double(8*g.n)*nparts/(8*g.nelem/4 + 3*g.nelem/4));
+  }
+}